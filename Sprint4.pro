@@ -1,5 +1,5 @@
 TEMPLATE = app
-CONFIG += console c++11
+CONFIG += console c++17 thread
 CONFIG -= app_bundle
 CONFIG -= qt
 
@@ -13,7 +13,22 @@ SOURCES += \
     tests.cpp \
     plan.cpp \
     flightplans.cpp \
-    output.cpp
+    output.cpp \
+    pathfinder.cpp \
+    route.cpp \
+    flightgraph.cpp \
+    citytable.cpp \
+    mappedfile.cpp \
+    threadpool.cpp \
+    visitedset.cpp \
+    pathstack.cpp \
+    landmarks.cpp \
+    contractionhierarchy.cpp \
+    allpairs.cpp \
+    plancache.cpp \
+    outputwriter.cpp \
+    networkgenerator.cpp \
+    benchmark.cpp
 
 HEADERS += \
     flightdata.h \
@@ -28,7 +43,26 @@ HEADERS += \
     queue.h \
     catch.hpp \
     plan.h \
-    flightplans.h
+    flightplans.h \
+    heap.h \
+    pathfinder.h \
+    route.h \
+    flightgraph.h \
+    citytable.h \
+    mappedfile.h \
+    threadpool.h \
+    visitedset.h \
+    vector.h \
+    nodepool.h \
+    pathstack.h \
+    landmarks.h \
+    contractionhierarchy.h \
+    allpairs.h \
+    plancache.h \
+    ringqueue.h \
+    outputwriter.h \
+    networkgenerator.h \
+    benchmark.h
 
 DISTFILES += \
     
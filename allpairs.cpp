@@ -0,0 +1,600 @@
+#include "allpairs.h"
+#include <limits>
+#include <stdexcept>
+
+//The SIMD kernels are compiled for their instruction sets one function at
+//a time, so the rest of the program still runs on any x86 processor
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ALLPAIRS_SIMD
+#include <immintrin.h>
+#endif
+
+//Half of the largest int, so that adding two distances never overflows
+const int AllPairs::UNREACHABLE = std::numeric_limits<int>::max() / 2;
+
+/**
+ * closeTile(c, stride)
+ *
+ * Runs the Floyd-Warshall algorithm within a tile along the diagonal,
+ * shortening each distance through each city of the tile in turn. A step
+ * never changes the row and column of the city it steps through, so that
+ * row is copied for the compiler to know it does not overlap the row being
+ * shortened, and to vectorize the inner loop.
+ *
+ * @param c - the first distance of the tile
+ * @param stride - the distance between the rows of the matrix
+ */
+static void closeTile(int* c, int stride)
+{
+    int through[AllPairs::TILE];
+
+    for(int k{}; k < AllPairs::TILE; k++)
+    {
+        for(int j{}; j < AllPairs::TILE; j++)
+            through[j] = c[k * stride + j];
+
+        for(int i{}; i < AllPairs::TILE; i++)
+        {
+            int toMiddle = c[i * stride + k];
+            int* row = c + i * stride;
+            for(int j{}; j < AllPairs::TILE; j++)
+            {
+                int via = toMiddle + through[j];
+                row[j] = (via < row[j]) ? via : row[j];
+            }
+        }
+    }
+}
+
+/**
+ * minPlus(c, a, b, stride)
+ *
+ * The plain kernel, used when the processor has neither AVX2 nor SSE4.1.
+ *
+ * Shortens each distance of tile c through the cities that tiles a and b
+ * share, taking the min-plus product c = min(c, a + b). Each row of c is
+ * finished at once, kept in a local array while every row of b is added
+ * to it.
+ *
+ * Once the tile along the diagonal is closed, routes through its cities
+ * are found by any order of these steps, since a distance shortened early
+ * is still the length of a route. So a may be c, and b may be c, for the
+ * tiles within the row and column of the diagonal tile.
+ *
+ * @param c - the first distance of the tile to shorten
+ * @param a - the first distance of the tile from the cities of c to the
+ *            cities stepped through
+ * @param b - the first distance of the tile from the cities stepped
+ *            through to the cities of c
+ * @param stride - the distance between the rows of the matrix
+ */
+static void minPlus(int* c, const int* a, const int* b, int stride)
+{
+    int row[AllPairs::TILE];
+
+    for(int i{}; i < AllPairs::TILE; i++)
+    {
+        for(int j{}; j < AllPairs::TILE; j++)
+            row[j] = c[i * stride + j];
+
+        for(int k{}; k < AllPairs::TILE; k++)
+        {
+            int toMiddle = a[i * stride + k];
+            const int* through = b + k * stride;
+            for(int j{}; j < AllPairs::TILE; j++)
+            {
+                int via = toMiddle + through[j];
+                row[j] = (via < row[j]) ? via : row[j];
+            }
+        }
+
+        for(int j{}; j < AllPairs::TILE; j++)
+            c[i * stride + j] = row[j];
+    }
+}
+
+#ifdef ALLPAIRS_SIMD
+/**
+ * minPlusSSE4(c, a, b, stride)
+ *
+ * minPlus() four distances at a time. Each half of a row of c is held
+ * within eight registers while every row of b is added to it.
+ *
+ * @param c - the first distance of the tile to shorten
+ * @param a - the first distance of the tile from the cities of c to the
+ *            cities stepped through
+ * @param b - the first distance of the tile from the cities stepped
+ *            through to the cities of c
+ * @param stride - the distance between the rows of the matrix
+ */
+__attribute__((target("sse4.1")))
+static void minPlusSSE4(int* c, const int* a, const int* b, int stride)
+{
+    const int lanes{4};
+    const int half{AllPairs::TILE / 2};
+
+    for(int i{}; i < AllPairs::TILE; i++)
+    {
+        for(int left{}; left < AllPairs::TILE; left += half)
+        {
+            __m128i* out = reinterpret_cast<__m128i*>(c + i * stride + left);
+            __m128i row[half / lanes];
+#pragma GCC unroll 8
+            for(int v{}; v < half / lanes; v++)
+                row[v] = _mm_loadu_si128(out + v);
+
+            for(int k{}; k < AllPairs::TILE; k++)
+            {
+                __m128i toMiddle = _mm_set1_epi32(a[i * stride + k]);
+                const __m128i* through =
+                        reinterpret_cast<const __m128i*>(b + k * stride + left);
+#pragma GCC unroll 8
+                for(int v{}; v < half / lanes; v++)
+                {
+                    __m128i via = _mm_add_epi32(toMiddle, _mm_loadu_si128(through + v));
+                    row[v] = _mm_min_epi32(row[v], via);
+                }
+            }
+
+#pragma GCC unroll 8
+            for(int v{}; v < half / lanes; v++)
+                _mm_storeu_si128(out + v, row[v]);
+        }
+    }
+}
+
+/**
+ * minPlusAVX2(c, a, b, stride)
+ *
+ * minPlus() eight distances at a time. Each row of c is held within eight
+ * registers while every row of b is added to it.
+ *
+ * @param c - the first distance of the tile to shorten
+ * @param a - the first distance of the tile from the cities of c to the
+ *            cities stepped through
+ * @param b - the first distance of the tile from the cities stepped
+ *            through to the cities of c
+ * @param stride - the distance between the rows of the matrix
+ */
+__attribute__((target("avx2")))
+static void minPlusAVX2(int* c, const int* a, const int* b, int stride)
+{
+    const int lanes{8};
+
+    for(int i{}; i < AllPairs::TILE; i++)
+    {
+        __m256i* out = reinterpret_cast<__m256i*>(c + i * stride);
+        __m256i row[AllPairs::TILE / lanes];
+#pragma GCC unroll 8
+        for(int v{}; v < AllPairs::TILE / lanes; v++)
+            row[v] = _mm256_loadu_si256(out + v);
+
+        for(int k{}; k < AllPairs::TILE; k++)
+        {
+            __m256i toMiddle = _mm256_set1_epi32(a[i * stride + k]);
+            const __m256i* through = reinterpret_cast<const __m256i*>(b + k * stride);
+#pragma GCC unroll 8
+            for(int v{}; v < AllPairs::TILE / lanes; v++)
+            {
+                __m256i via = _mm256_add_epi32(toMiddle, _mm256_loadu_si256(through + v));
+                row[v] = _mm256_min_epi32(row[v], via);
+            }
+        }
+
+#pragma GCC unroll 8
+        for(int v{}; v < AllPairs::TILE / lanes; v++)
+            _mm256_storeu_si256(out + v, row[v]);
+    }
+}
+#endif
+
+/**
+ * Default constructor - empty tables, which must be built before use
+ */
+AllPairs::AllPairs() : graph{nullptr}, timeTag{false}, freeFlights{false},
+    numCities{0}, stride{0}, distances{nullptr}, next{nullptr}, kernel{fastestKernel()} {}
+
+/**
+ * Destructor
+ */
+AllPairs::~AllPairs()
+{
+    reset();
+}
+
+/**
+ * reset()
+ *
+ * Frees the tables, leaving them empty.
+ */
+void AllPairs::reset()
+{
+    delete[] distances;
+    delete[] next;
+    graph = nullptr;
+    numCities = 0;
+    stride = 0;
+    freeFlights = false;
+    distances = nullptr;
+    next = nullptr;
+}
+
+/**
+ * findDistances(pool)
+ *
+ * Runs the blocked Floyd-Warshall algorithm. For each tile along the
+ * diagonal, that tile is relaxed through its own cities first, and then
+ * the tiles of its row and column, which only depend on it, and then every
+ * other tile, which only depends on the tiles of that row and column.
+ * The tiles off the diagonal are relaxed with the kernel chosen for the
+ * tables.
+ *
+ * @param pool - the threads to relax the tiles of each phase on
+ */
+void AllPairs::findDistances(ThreadPool& pool)
+{
+    int numTiles = stride / TILE;
+    void (*relax)(int*, const int*, const int*, int){minPlus};
+#ifdef ALLPAIRS_SIMD
+    if(kernel == Kernel::AVX2)
+        relax = minPlusAVX2;
+    else if(kernel == Kernel::SSE4)
+        relax = minPlusSSE4;
+#endif
+
+    auto tile = [this](int row, int column)
+    {
+        return distances + static_cast<long long>(row) * TILE * stride + column * TILE;
+    };
+
+    for(int k{}; k < numTiles; k++)
+    {
+        int* diagonal = tile(k, k);
+        closeTile(diagonal, stride);
+
+        //tasks below numTiles are the row of the diagonal tile, and the
+        //rest are its column, skipping the diagonal tile itself
+        pool.run(2 * numTiles, [&](int, int task)
+        {
+            int other = task % numTiles;
+            if(other == k)
+                return;
+            if(task < numTiles)
+                relax(tile(k, other), diagonal, tile(k, other), stride);
+            else
+                relax(tile(other, k), tile(other, k), diagonal, stride);
+        });
+
+        pool.run(numTiles * numTiles, [&](int, int task)
+        {
+            int row = task / numTiles;
+            int column = task % numTiles;
+            if(row == k || column == k)
+                return;
+            relax(tile(row, column), tile(row, k), tile(k, column), stride);
+        });
+    }
+}
+
+/**
+ * findNextFlights(city, best)
+ *
+ * Takes each flight of the city in schedule order, keeping for each target
+ * the first flight that leads to the smallest total.
+ *
+ * @param city - the id of the city to fill the row of
+ * @param best - room for the smallest total found to each city
+ */
+void AllPairs::findNextFlights(int city, int* best)
+{
+    int* row = next + static_cast<long long>(city) * stride;
+    for(int j{}; j < numCities; j++)
+    {
+        best[j] = UNREACHABLE;
+        row[j] = -1;
+    }
+
+    for(int f = graph->firstFlight(city); f < graph->endFlight(city); f++)
+    {
+        int weight = static_cast<int>(graph->getWeight(f, timeTag));
+        const int* from = distances + static_cast<long long>(graph->getTarget(f)) * stride;
+        for(int j{}; j < numCities; j++)
+        {
+            int via = weight + from[j];
+            if(via < best[j])
+            {
+                best[j] = via;
+                row[j] = f;
+            }
+        }
+    }
+    row[city] = -1;
+}
+
+/**
+ * build(graph, timeTag, pool)
+ *
+ * Every distance starts as the shortest flight between the two cities, and
+ * is then shortened through every other city.
+ *
+ * @param graph - the flight schedule, which must outlive the tables
+ * @param timeTag - true to weigh flights by time, false by cost in cents
+ * @param pool - the threads to build the tables on
+ * @exception overflow_error if a route could be too long to hold in an int
+ */
+void AllPairs::build(const FlightGraph& graph, bool timeTag, ThreadPool& pool)
+{
+    reset();
+    int cities = graph.getNumCities();
+
+    //no best route takes more flights than there are cities
+    long long longest{0};
+    bool free{false};
+    for(int f{}; f < graph.getNumFlights(); f++)
+    {
+        if(graph.getWeight(f, timeTag) > longest)
+            longest = graph.getWeight(f, timeTag);
+        if(graph.getWeight(f, timeTag) == 0)
+            free = true;
+    }
+    if(cities > 1 && longest > (UNREACHABLE - 1) / (cities - 1))
+        throw std::overflow_error("AllPairs::build() - routes are too long for the tables");
+
+    this->graph = &graph;
+    this->timeTag = timeTag;
+    freeFlights = free;
+    numCities = cities;
+    stride = (numCities + TILE - 1) / TILE * TILE;
+
+    long long cells = static_cast<long long>(stride) * stride;
+    distances = new int[cells];
+    next = new int[cells];
+    for(long long i{}; i < cells; i++)
+        distances[i] = UNREACHABLE;
+
+    for(int c{}; c < numCities; c++)
+    {
+        int* row = distances + static_cast<long long>(c) * stride;
+        row[c] = 0;
+        for(int f = graph.firstFlight(c); f < graph.endFlight(c); f++)
+        {
+            int weight = static_cast<int>(graph.getWeight(f, timeTag));
+            if(weight < row[graph.getTarget(f)])
+                row[graph.getTarget(f)] = weight;
+        }
+    }
+
+    findDistances(pool);
+
+    int* best = new int[static_cast<long long>(pool.size()) * numCities];
+    pool.run(numCities, [&](int worker, int city)
+    {
+        findNextFlights(city, best + static_cast<long long>(worker) * numCities);
+    });
+    delete[] best;
+}
+
+/**
+ * findRoute(from, to, route)
+ *
+ * When some flight weighs nothing, the first flight of a city may lead to a
+ * city just as far away whose own first flight leads back, so the route is
+ * read off by findFreeRoute() instead.
+ *
+ * @param from - the id of the city the route leaves from
+ * @param to - the id of the city the route goes to, which must not be from
+ * @param route - the route to add the flights to
+ * @return true if the flights were added, false if the city cannot be
+ *         reached
+ * @exception logic_error if the flights loop back on themselves, which
+ *            they cannot when every flight weighs something
+ */
+bool AllPairs::findRoute(int from, int to, Route& route) const
+{
+    if(getNextFlight(from, to) == -1)
+        return false;
+    if(freeFlights)
+        return findFreeRoute(from, to, route);
+
+    int legs{0};
+    for(int c = from; c != to; c = graph->getTarget(getNextFlight(c, to)))
+    {
+        if(legs++ == numCities)
+            throw std::logic_error("AllPairs::findRoute() - route loops back on itself");
+        route.addLeg(getNextFlight(c, to));
+    }
+    return true;
+}
+
+/**
+ * findFreeRoute(from, to, route)
+ *
+ * Takes the first flight of each city that stays on a shortest route, as
+ * a PathFinder does, without passing back through the route so far. A
+ * flight that weighs nothing is only taken if reachesTarget() finds a way
+ * on from it, so the route is the one backtracking would list first.
+ *
+ * @param from - the id of the city the route leaves from
+ * @param to - the id of the city the route goes to, which can be reached
+ * @param route - the route to add the flights to
+ * @return true, once the flights are added
+ * @exception logic_error if no flight stays on a shortest route, which
+ *            cannot happen for tables built from the graph
+ */
+bool AllPairs::findFreeRoute(int from, int to, Route& route) const
+{
+    Vector<bool> onPath{};
+    Vector<int> searched{};
+    onPath.resize(numCities, false);
+    searched.resize(numCities, -1);
+    onPath[from] = true;
+
+    int c = from;
+    while(c != to)
+    {
+        int best{-1};
+        for(int f = graph->firstFlight(c); best == -1 && f < graph->endFlight(c); f++)
+        {
+            int other = graph->getTarget(f);
+            int weight = static_cast<int>(graph->getWeight(f, timeTag));
+            if(onPath[other] || getDistance(other, to) == UNREACHABLE ||
+               weight + getDistance(other, to) != getDistance(c, to))
+                continue;
+            if(weight != 0 || reachesTarget(other, to, onPath, searched, f))
+                best = f;
+        }
+
+        if(best == -1)
+            throw std::logic_error("AllPairs::findRoute() - no shortest route on from a city");
+        route.addLeg(best);
+        c = graph->getTarget(best);
+        onPath[c] = true;
+    }
+    return true;
+}
+
+/**
+ * reachesTarget(city, to, onPath, searched, search)
+ *
+ * Searches the cities just as far from the target as the city, over the
+ * flights that stay on a shortest route, for a way on that avoids the
+ * route so far. The cities of the route are no closer to the target than
+ * the city, so once a closer city is found every shortest route on from it
+ * avoids them.
+ *
+ * @param city - the id of the city a flight that weighs nothing leads to
+ * @param to - the id of the city the route goes to
+ * @param onPath - the cities of the route so far
+ * @param searched - the search that last reached each city
+ * @param search - a number that no earlier search was given
+ * @return true if a shortest route from the city reaches the target without
+ *         passing back through the route so far
+ */
+bool AllPairs::reachesTarget(int city, int to, const Vector<bool>& onPath,
+                             Vector<int>& searched, int search) const
+{
+    if(city == to)
+        return true;
+
+    Vector<int> stack{};
+    stack.pushBack(city);
+    searched[city] = search;
+    while(!stack.empty())
+    {
+        int current = stack.popBack();
+        for(int f = graph->firstFlight(current); f < graph->endFlight(current); f++)
+        {
+            int other = graph->getTarget(f);
+            if(getDistance(other, to) == UNREACHABLE ||
+               static_cast<int>(graph->getWeight(f, timeTag)) + getDistance(other, to) !=
+               getDistance(current, to) || onPath[other])
+                continue;
+            if(other == to || getDistance(other, to) < getDistance(city, to))
+                return true;
+            if(searched[other] == search)
+                continue;
+
+            searched[other] = search;
+            stack.pushBack(other);
+        }
+    }
+    return false;
+}
+
+/**
+ * setKernel(kernel)
+ *
+ * The tables are the same whichever kernel builds them, so this only
+ * changes how long the next build takes.
+ *
+ * @param kernel - the kernel to relax the tiles of the matrix with
+ * @return true if the kernel will be used, false if the processor does
+ *         not support it, in which case the kernel is left unchanged
+ */
+bool AllPairs::setKernel(Kernel kernel)
+{
+    if(!isSupported(kernel))
+        return false;
+    this->kernel = kernel;
+    return true;
+}
+
+/**
+ * isSupported(kernel)
+ * @param kernel - a way to relax the tiles of the matrix
+ * @return true if this processor has the instructions the kernel uses
+ */
+bool AllPairs::isSupported(Kernel kernel)
+{
+#ifdef ALLPAIRS_SIMD
+    if(kernel == Kernel::AVX2)
+        return __builtin_cpu_supports("avx2");
+    if(kernel == Kernel::SSE4)
+        return __builtin_cpu_supports("sse4.1");
+#endif
+    return kernel == Kernel::SCALAR;
+}
+
+/**
+ * fastestKernel()
+ * @return the kernel with the widest instructions this processor has
+ */
+AllPairs::Kernel AllPairs::fastestKernel()
+{
+    if(isSupported(Kernel::AVX2))
+        return Kernel::AVX2;
+    if(isSupported(Kernel::SSE4))
+        return Kernel::SSE4;
+    return Kernel::SCALAR;
+}
+
+/**
+ * isBuilt()
+ * @return true if the tables have been built
+ */
+bool AllPairs::isBuilt() const
+{
+    return graph != nullptr;
+}
+
+/**
+ * getTimeTag()
+ * @return true if the tables weigh flights by time, false if by cost
+ */
+bool AllPairs::getTimeTag() const
+{
+    return timeTag;
+}
+
+/**
+ * getDistance(from, to)
+ * @param from - the id of a city
+ * @param to - the id of another city
+ * @return the distance of the best route between the cities, or
+ *         UNREACHABLE if there is none
+ */
+int AllPairs::getDistance(int from, int to) const
+{
+    return distances[static_cast<long long>(from) * stride + to];
+}
+
+/**
+ * getNextFlight(from, to)
+ * @param from - the id of a city
+ * @param to - the id of another city
+ * @return the first flight of the best route between the cities, or -1 if
+ *         there is none
+ */
+int AllPairs::getNextFlight(int from, int to) const
+{
+    return next[static_cast<long long>(from) * stride + to];
+}
+
+/**
+ * getKernel()
+ * @return the kernel the tiles of the matrix are relaxed with
+ */
+AllPairs::Kernel AllPairs::getKernel() const
+{
+    return kernel;
+}
@@ -0,0 +1,123 @@
+#ifndef ALLPAIRS_H
+#define ALLPAIRS_H
+
+#include <flightgraph.h>
+#include <route.h>
+#include <threadpool.h>
+#include <vector.h>
+
+/**
+ * The AllPairs class holds the distance between every pair of cities of a
+ * FlightGraph for one metric (duration, or cost in cents), along with the
+ * first flight of the best route between them, so that the best route for
+ * any request is read off one flight at a time without searching.
+ *
+ * The distances are found with the Floyd-Warshall algorithm, with the
+ * matrix split into square tiles small enough that the three tiles used by
+ * each step stay in cache. For each tile along the diagonal, the tile
+ * itself is finished first, then the rest of its row and column of tiles,
+ * and then every other tile, with the tiles of each of the last two phases
+ * spread across the threads of a ThreadPool. Each tile is relaxed a row at
+ * a time, which is a min-plus product of two other tiles. On x86 machines
+ * that have them, this is done with AVX2 or SSE4.1 instructions, eight or
+ * four distances at once, and otherwise with a plain loop. The fastest
+ * kernel the processor supports is picked when the tables are made, by
+ * asking the processor (through CPUID) which instructions it has.
+ *
+ * Once the distances are known, the first flight between each pair is the
+ * flight that leads to the smallest total, with ties going to the flight
+ * that comes first within the schedule, so routes are the same ones that a
+ * PathFinder returns for the best plan. A flight that weighs nothing leads
+ * to a city just as far away, whose first flight may lead back, so when a
+ * schedule has one, routes are read off the distances instead, the same
+ * way a PathFinder reads them, taking the first flight on a shortest route
+ * that does not pass back through the route so far.
+ *
+ * Distances are held as ints to halve the size of the matrix, which takes
+ * O(V^2) memory, so the tables are meant for networks of up to a few
+ * thousand cities.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class AllPairs
+{
+    public:
+
+        //The ways a tile can be relaxed
+        enum class Kernel
+        {
+            SCALAR,
+            SSE4,
+            AVX2
+        };
+
+    private:
+        const FlightGraph* graph;   //graph the tables were built from
+        bool timeTag;               //time if true, cost if false
+        bool freeFlights;           //some flight weighs nothing
+        int numCities;
+        int stride;                 //cities rounded up to a whole tile
+        int* distances;             //distance between each pair of cities
+        int* next;                  //first flight from each city to each city
+        Kernel kernel;              //relaxes the tiles of the matrix
+
+        //Frees the tables
+        void reset();
+
+        //Runs the Floyd-Warshall algorithm over the distance matrix
+        void findDistances(ThreadPool& pool);
+
+        //Fills the row of first flights of a city
+        void findNextFlights(int city, int* best);
+
+        //Reads a route off the distances, for schedules with flights that
+        //weigh nothing
+        bool findFreeRoute(int from, int to, Route& route) const;
+
+        //Returns true if a shortest route from the city to the target
+        //avoids the cities of the route so far
+        bool reachesTarget(int city, int to, const Vector<bool>& onPath,
+                           Vector<int>& searched, int search) const;
+
+    public:
+
+        //Distance of the cities that cannot be reached from each other
+        static const int UNREACHABLE;
+
+        //Side of the square tiles the matrix is split into
+        static const int TILE = 64;
+
+        //Constructors
+        AllPairs();
+        AllPairs(const AllPairs& other) = delete;
+        AllPairs& operator=(const AllPairs& other) = delete;
+        ~AllPairs();
+
+        //Builds the tables, weighing flights by time or by cost
+        void build(const FlightGraph& graph, bool timeTag, ThreadPool& pool);
+
+        //Adds the flights of the best route between two cities to the route
+        bool findRoute(int from, int to, Route& route) const;
+
+        //Uses a kernel for the next build, returning false if unsupported
+        bool setKernel(Kernel kernel);
+
+        //Returns true if the processor has the instructions of the kernel
+        static bool isSupported(Kernel kernel);
+
+        //Returns the fastest kernel the processor supports
+        static Kernel fastestKernel();
+
+        //Getters
+        bool isBuilt() const;
+        bool getTimeTag() const;
+        int getDistance(int from, int to) const;
+        int getNextFlight(int from, int to) const;
+        Kernel getKernel() const;
+};
+
+#endif // ALLPAIRS_H
@@ -0,0 +1,228 @@
+#include "benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+#include <output.h>
+#include <sys/resource.h>
+
+/**
+ * secondsSince(start)
+ * @param start - the time a stage started
+ * @return the seconds since the stage started
+ */
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> took{std::chrono::steady_clock::now() - start};
+    return took.count();
+}
+
+/**
+ * Constructor with Topology, int, int, int, int, unsigned int
+ *
+ * The network is made here, and written to files once run() is called.
+ *
+ * @param topology - the shape of the network
+ * @param numCities - the number of cities within the network
+ * @param numLegs - the number of legs, each flown both ways
+ * @param numRequests - the number of requests to solve
+ * @param numThreads - the threads of the Output run, which defaults to one
+ *                     for each core
+ * @param seed - the seed of the network and of the requests
+ */
+Benchmark::Benchmark(Topology topology, int numCities, int numLegs,
+                     int numRequests, int numThreads, unsigned int seed) :
+    network{topology, numCities, numLegs, seed}, numRequests{numRequests},
+    numThreads{numThreads}, scheduleFile{"benchmark_schedule.txt"},
+    requestFile{"benchmark_requests.txt"}, outputFile{"benchmark_output.txt"}
+{
+}
+
+/**
+ * run(out)
+ *
+ * The files are removed once every stage has run.
+ *
+ * @param out - the stream to print the report to
+ * @exception invalid_argument if the files cannot be written
+ */
+void Benchmark::run(std::ostream& out)
+{
+    const char* names[] = {"geometric", "hubs", "grid"};
+    out << "Network: " << names[static_cast<int>(network.getTopology())] << ", "
+        << network.getNumCities() << " cities, " << network.getNumLegs()
+        << " legs, " << numRequests << " requests\n";
+    out << std::fixed << std::setprecision(3);
+
+    //Generate
+    auto start = std::chrono::steady_clock::now();
+    if(!network.writeSchedule(scheduleFile.c_str()) ||
+       !network.writeRequests(requestFile.c_str(), numRequests))
+        throw std::invalid_argument("Benchmark files cannot be written.");
+    out << "generate:   " << secondsSince(start) << " s\n";
+
+    //Parse
+    start = std::chrono::steady_clock::now();
+    FlightData data(&scheduleFile[0]);
+    double parseTime{secondsSince(start)};
+    start = std::chrono::steady_clock::now();
+    FlightGraph graph(data);
+    out << "parse:      " << parseTime << " s, graph " << secondsSince(start) << " s\n";
+
+    FlightRequests requests(&requestFile[0], graph.getCities());
+    const Vector<Request>& reqs{requests.getRequests()};
+
+    //Solve, one request at a time with each search
+    out << "solve (us): " << std::setw(14) << "search" << std::setw(10) << "setup s"
+        << std::setw(10) << "mean" << std::setw(10) << "p50" << std::setw(10) << "p90"
+        << std::setw(10) << "p99" << std::setw(10) << "max" << '\n';
+    const char* searches[] = {"DIJKSTRA", "BIDIRECTIONAL", "ASTAR", "HIERARCHY",
+                              "ALL_PAIRS", "K_SHORTEST"};
+    for(int s{}; s < 6; s++)
+    {
+        if(s == 4 && graph.getNumCities() > ALL_PAIRS_LIMIT)
+        {
+            out << "            " << std::setw(14) << searches[s]
+                << "  skipped, more than " << ALL_PAIRS_LIMIT << " cities\n";
+            continue;
+        }
+
+        //tables the search needs are built first, and timed apart
+        Landmarks landmarks;
+        ContractionHierarchy costHierarchy, timeHierarchy;
+        AllPairs costTable, timeTable;
+        start = std::chrono::steady_clock::now();
+        if(s == 2)
+            landmarks.build(graph);
+        else if(s == 3)
+        {
+            costHierarchy.build(graph, false);
+            timeHierarchy.build(graph, true);
+        }
+        else if(s == 4)
+        {
+            ThreadPool pool(numThreads);
+            costTable.build(graph, false, pool);
+            timeTable.build(graph, true, pool);
+        }
+        double setup{secondsSince(start)};
+
+        PathFinder finder(graph);
+        Vector<double> latencies{};
+        latencies.reserve(reqs.length());
+        for(int i{}; i < reqs.length(); i++)
+        {
+            const Request& r{reqs[i]};
+            start = std::chrono::steady_clock::now();
+            if(s == 0)
+                finder.bestPlan(r);
+            else if(s == 1)
+                finder.bidirectionalPlan(r);
+            else if(s == 2)
+                finder.aStarPlan(r, landmarks);
+            else if(s == 3)
+                finder.hierarchyPlan(r, r.getTimeTag() ? timeHierarchy : costHierarchy);
+            else if(s == 4)
+                finder.allPairsPlan(r, r.getTimeTag() ? timeTable : costTable);
+            else
+                finder.topPlans(r, 3);
+            latencies.pushBack(secondsSince(start) * 1e6);
+        }
+        report(out, searches[s], latencies, setup);
+    }
+
+    //Output, as the planner is run from the command line
+    start = std::chrono::steady_clock::now();
+    {
+        Output o(&scheduleFile[0], &requestFile[0], &outputFile[0],
+                 SearchMode::K_SHORTEST, 3, numThreads);
+        double solveTime{secondsSince(start)};
+        start = std::chrono::steady_clock::now();
+        o.print();
+        out << "output:     parse and solve " << solveTime << " s, print "
+            << secondsSince(start) << " s\n";
+    }
+
+    out << "memory:     peak RSS " << peakMemory() << " KiB\n";
+    out << std::defaultfloat;
+
+    remove(scheduleFile.c_str());
+    remove(requestFile.c_str());
+    remove(outputFile.c_str());
+}
+
+/**
+ * report(out, name, latencies, setup)
+ *
+ * @param out - the stream to print the row to
+ * @param name - the name of the search
+ * @param latencies - the latency of each request, in microseconds
+ * @param setup - the seconds spent building the tables of the search
+ */
+void Benchmark::report(std::ostream& out, const char* name,
+                       Vector<double>& latencies, double setup)
+{
+    std::sort(latencies.begin(), latencies.end());
+    double total{0};
+    for(double latency : latencies)
+        total += latency;
+    double mean{latencies.empty() ? 0 : total / latencies.length()};
+
+    out << "            " << std::setw(14) << name << std::setw(10) << setup
+        << std::setw(10) << mean << std::setw(10) << percentile(latencies, 0.5)
+        << std::setw(10) << percentile(latencies, 0.9)
+        << std::setw(10) << percentile(latencies, 0.99)
+        << std::setw(10) << percentile(latencies, 1) << '\n';
+}
+
+/**
+ * percentile(sorted, share)
+ *
+ * Uses the nearest rank, so the result is always one of the latencies.
+ *
+ * @param sorted - latencies in ascending order
+ * @param share - the share of latencies at or below the result, up to 1
+ * @return the latency, or 0 if there are none
+ */
+double Benchmark::percentile(const Vector<double>& sorted, double share)
+{
+    if(sorted.empty())
+        return 0;
+    int rank{static_cast<int>(std::ceil(share * sorted.length()))};
+    return sorted[std::min(std::max(rank, 1), sorted.length()) - 1];
+}
+
+/**
+ * parseTopology(name, topology)
+ *
+ * @param name - "geometric", "hubs" or "grid"
+ * @param topology - set to the topology with the name
+ * @return true if the name was known, false otherwise
+ */
+bool Benchmark::parseTopology(const char* name, Topology& topology)
+{
+    if(strcmp(name, "geometric") == 0)
+        topology = Topology::GEOMETRIC;
+    else if(strcmp(name, "hubs") == 0)
+        topology = Topology::HUB_AND_SPOKE;
+    else if(strcmp(name, "grid") == 0)
+        topology = Topology::GRID;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * peakMemory()
+ * @return the most memory the process has held at once, in KiB
+ */
+long Benchmark::peakMemory()
+{
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) == -1)
+        return 0;
+    return usage.ru_maxrss;
+}
@@ -0,0 +1,67 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <iostream>
+#include <string>
+#include <networkgenerator.h>
+#include <vector.h>
+
+/**
+ * The Benchmark class measures the planner on a synthetic network made by
+ * a NetworkGenerator. The schedule and requests are written to files, so
+ * every stage is measured from the same input a user would give:
+ *
+ * - generate: writing the schedule and request files
+ * - parse: reading the schedule into FlightData, and building the graph
+ * - solve: the latency of each request for each search, as percentiles,
+ *   with the time spent on preprocessing shown apart
+ * - output: a full run of Output, from its constructor to print()
+ * - memory: the peak resident set size of the process
+ *
+ * Searches that need tables of every pair of cities are skipped once the
+ * network has more than ALL_PAIRS_LIMIT cities.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class Benchmark
+{
+    private:
+        NetworkGenerator network;
+        int numRequests;
+        int numThreads;                 //threads of the Output run
+        std::string scheduleFile;
+        std::string requestFile;
+        std::string outputFile;
+
+        //Prints a row of latencies, which are sorted in place
+        static void report(std::ostream& out, const char* name,
+                           Vector<double>& latencies, double setup);
+
+        //Returns the latency below which the given share of latencies fall
+        static double percentile(const Vector<double>& sorted, double share);
+
+    public:
+
+        //Most cities the ALL_PAIRS search is measured on
+        static const int ALL_PAIRS_LIMIT = 4096;
+
+        //Constructors
+        Benchmark(Topology topology, int numCities, int numLegs,
+                  int numRequests, int numThreads = 0,
+                  unsigned int seed = 2341);
+
+        //Runs every stage, printing a report as it goes
+        void run(std::ostream& out);
+
+        //Reads "geometric", "hubs" or "grid", returning false otherwise
+        static bool parseTopology(const char* name, Topology& topology);
+
+        //Returns the peak resident set size of the process, in KiB
+        static long peakMemory();
+};
+
+#endif // BENCHMARK_H
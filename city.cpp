@@ -6,32 +6,43 @@
 /**
  * Default Constructor
  */
-City::City() : name{} {}
+City::City() : name{}, id{-1} {}
 
 /**
  * Constructor with name parameter
  * @param name - the name to set the city to
  */
-City::City(String name) : name{name} {}
+City::City(String name) : name{std::move(name)}, id{-1} {}
+
+/**
+ * Constructor with name and id parameters
+ * @param name - the name to set the city to
+ * @param id - the id of the name within the CityTable
+ */
+City::City(String name, int id) : name{std::move(name)}, id{id} {}
 
 /**
  * Operator== overload
  * @param rhs - the city reference to compare this City to
- * @return true if the names of each city are equal, false if not
+ * @return true if the ids (or the names, if either city has no id) of each
+ *         city are equal, false if not
  */
 bool City::operator==(const City& rhs)
 {
+    if(id != -1 && rhs.id != -1)
+        return id == rhs.id;
     return (name == rhs.name);
 }
 
 /**
  * Operator!= overload
  * @param rhs - the city reference to compare this City to
- * @return false if the names of each city are equal, true if not
+ * @return false if the ids (or the names, if either city has no id) of each
+ *         city are equal, true if not
  */
 bool City::operator!=(const City& rhs)
 {
-    return !(this->getName() == rhs.getName());
+    return !(*this == rhs);
 }
 
 /**
@@ -55,6 +66,27 @@ void City::setName(const String& value)
 }
 
 
+/**
+ * getId()
+ *
+ * @return the id of the city within the CityTable, or -1 if it has none
+ */
+int City::getId() const
+{
+    return id;
+}
+
+/**
+ * setId(int value)
+ *
+ * @param value - the id of the city within the CityTable
+ */
+void City::setId(int value)
+{
+    id = value;
+}
+
+
 /**
  * operator << overload
  * @param o - the ostream reference to add data to
@@ -79,14 +111,32 @@ Origin::Origin() : City(), cost{}, duration{}, destinations{} {}
  * Constructor with String
  * @param cityName - the String to name the Origin city with
  */
-Origin::Origin(String cityName) : City(cityName), cost{}, duration{}, destinations{} {}
+Origin::Origin(String cityName) : City(std::move(cityName)), cost{}, duration{},
+    destinations{} {}
+
+/**
+ * Constructor with String and int
+ * @param cityName - the String to name the Origin city with
+ * @param id - the id of the name within the CityTable
+ */
+Origin::Origin(String cityName, int id) : City(std::move(cityName), id), cost{},
+    duration{}, destinations{} {}
 
 /**
  * Copy constructor
  * @param other - the Origin reference to copy objects from
  */
-Origin::Origin(const Origin& other) : City(other.getName()), cost{other.cost},
-    duration{other.duration}, destinations{other.destinations} {}
+Origin::Origin(const Origin& other) : City(other.getName(), other.id),
+    cost{other.cost}, duration{other.duration},
+    destinations{other.destinations} {}
+
+/**
+ * Move constructor
+ * @param other - the Origin reference to move the name and destinations from
+ */
+Origin::Origin(Origin&& other) noexcept : City(std::move(other.name), other.id),
+    cost{other.cost}, duration{other.duration},
+    destinations{std::move(other.destinations)} {}
 
 /**
  * Operator= overload (to satisfy Rule of 3)
@@ -96,12 +146,28 @@ Origin::Origin(const Origin& other) : City(other.getName()), cost{other.cost},
 Origin& Origin::operator=(const Origin& other)
 {
     name = other.name;
+    id = other.id;
     destinations = other.destinations;
     cost = other.cost;
     duration = other.duration;
     return *this;
 }
 
+/**
+ * Move assignment operator
+ * @param other - the Origin reference to move the name and destinations from
+ * @return a reference to this Origin object, containing the new data
+ */
+Origin& Origin::operator=(Origin&& other) noexcept
+{
+    name = std::move(other.name);
+    id = other.id;
+    destinations = std::move(other.destinations);
+    cost = other.cost;
+    duration = other.duration;
+    return *this;
+}
+
 /**
  * getDuration
  * @return the duration of the flight to the next destination
@@ -154,9 +220,9 @@ LinkedList<Destination>& Origin::getDestinations()
 /**
  * getDestinations() const
  *
- * @return the list of destinations
+ * @return a const reference to the list of destinations
  */
-LinkedList<Destination> Origin::getDestinations() const
+const LinkedList<Destination>& Origin::getDestinations() const
 {
     return destinations;
 }
@@ -198,8 +264,18 @@ std::ostream& operator<<(std::ostream& o, const Origin& orig)
  * @param other - the data to copy from
  */
 Destination::Destination(const Destination& other) :
-    City(other.getName()), cost{other.cost}, duration{other.duration},
-    originPtr{other.getOriginPtr()}, visited{other.visited} {}
+    City(other.getName(), other.id), cost{other.cost},
+    duration{other.duration}, originPtr{other.getOriginPtr()},
+    visited{other.visited} {}
+
+/**
+ * Move constructor
+ * @param other - the data to move the name from, and copy the rest from
+ */
+Destination::Destination(Destination&& other) noexcept :
+    City(std::move(other.name), other.id), cost{other.cost},
+    duration{other.duration}, originPtr{other.originPtr},
+    visited{other.visited} {}
 
 /**
  * operator= overload (to satisfy Rule of 3)
@@ -209,6 +285,7 @@ Destination::Destination(const Destination& other) :
 Destination& Destination::operator=(const Destination& other)
 {
     name = other.getName();
+    id = other.id;
     cost = other.getCost();
     duration = other.getDuration();
     originPtr = other.getOriginPtr();
@@ -216,6 +293,22 @@ Destination& Destination::operator=(const Destination& other)
     return *this;
 }
 
+/**
+ * Move assignment operator
+ * @param other - the data to move the name from, and copy the rest from
+ * @return a reference to this Destination object containing the new data
+ */
+Destination& Destination::operator=(Destination&& other) noexcept
+{
+    name = std::move(other.name);
+    id = other.id;
+    cost = other.cost;
+    duration = other.duration;
+    originPtr = other.originPtr;
+    visited = other.visited;
+    return *this;
+}
+
 /**
  * Constructor with String, int, int
  * @param cityName - the name of the Destination
@@ -223,17 +316,18 @@ Destination& Destination::operator=(const Destination& other)
  * @param duration - the duration to fly to the Destination from the Origin city
  */
 Destination::Destination(String cityName, double cost, int duration)
-    : City(cityName), cost{cost}, duration{duration}, originPtr{nullptr}, visited{false} {}
+    : City(std::move(cityName)), cost{cost}, duration{duration}, originPtr{nullptr}, visited{false} {}
 
 /**
  * Constructor with String, int, int
  * @param cityName - the name of the Destination
  * @param cost - the cost to fly to the Destination from the Origin city
  * @param duration - the duration to fly to the Destination from the Origin city
- * @param ptr - the pointer to the Origin city object with the same name
+ * @param ptr - the pointer to the Origin city object with the same name, whose
+ *              id is also given to the Destination
  */
 Destination::Destination(String cityName, double cost, int duration, Origin* ptr)
-    : City(cityName), cost{cost}, duration{duration}, originPtr{ptr}, visited{false}{}
+    : City(std::move(cityName), (ptr != nullptr) ? ptr->getId() : -1), cost{cost}, duration{duration}, originPtr{ptr}, visited{false}{}
 
 /**
  * getCost()
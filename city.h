@@ -9,6 +9,10 @@
  * comparison between an Origin and Destination city when determining
  * flight patterns.
  *
+ * The id of a City is the id given to its name by a CityTable, or -1 if the
+ * name has not been given an id. Cities that both have ids are compared by
+ * their ids rather than by their names.
+ *
  * This class will be used in the Sprint4: Flight Planner project
  * in SMU CSE 2341.
  *
@@ -20,20 +24,25 @@ class City
 {
     public:
         String name;
+        int id;                     //id within the CityTable
     public:
 
         //Constructors
         City();
         City(String name);
+        City(String name, int id);
 
         //operators to compare all derived city classes
         bool operator==(const City& rhs);
         bool operator!=(const City& rhs);
 
-        //Getter and setter
+        //Getters and setters
         String getName() const;
         void setName(const String& value);
 
+        int getId() const;
+        void setId(int value);
+
         //ostream operator<<
         friend std::ostream& operator<<(std::ostream& o, const City& city);
 };
@@ -71,8 +80,11 @@ class Origin : public City
         //Constructors
         Origin();
         Origin(String cityName);
+        Origin(String cityName, int id);
         Origin(const Origin& other);
+        Origin(Origin&& other) noexcept;
         Origin& operator=(const Origin& other);
+        Origin& operator=(Origin&& other) noexcept;
 
         //Getters and setters
         int getDuration() const;
@@ -82,7 +94,7 @@ class Origin : public City
         void setCost(double value);
 
         LinkedList<Destination>& getDestinations();
-        LinkedList<Destination> getDestinations() const;
+        const LinkedList<Destination>& getDestinations() const;
         void setDestinations(const LinkedList<Destination>& value);
 
         //ostream operator overload
@@ -118,7 +130,9 @@ class Destination : public City
         //Constructors
         Destination() : City(), cost{0.0}, duration{0}, originPtr{nullptr}, visited{false} {}
         Destination(const Destination& other);
+        Destination(Destination&& other) noexcept;
         Destination& operator=(const Destination& other);
+        Destination& operator=(Destination&& other) noexcept;
         Destination(String cityName, double cost, int duration);
         Destination(String cityName, double cost, int duration, Origin* ptr);
 
@@ -0,0 +1,226 @@
+#include "citytable.h"
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * Default constructor
+ */
+CityTable::CityTable() : numCities{0}, nameCapacity{16},
+    names{new String[16]}, slotCapacity{32}, slots{new int[32]}
+{
+    for(int i{}; i < slotCapacity; i++)
+        slots[i] = -1;
+}
+
+/**
+ * Copy constructor
+ * @param other - the CityTable to copy data from
+ */
+CityTable::CityTable(const CityTable& other) : numCities{other.numCities},
+    nameCapacity{other.nameCapacity}, names{new String[other.nameCapacity]},
+    slotCapacity{other.slotCapacity}, slots{new int[other.slotCapacity]}
+{
+    for(int i{}; i < numCities; i++)
+        names[i] = other.names[i];
+    for(int i{}; i < slotCapacity; i++)
+        slots[i] = other.slots[i];
+}
+
+/**
+ * operator= overload (to satisfy Rule of 3)
+ * @param other - the CityTable to copy data from
+ * @return a reference to this CityTable, containing the data from other
+ */
+CityTable& CityTable::operator=(const CityTable& other)
+{
+    if(this != &other)
+    {
+        delete[] names;
+        delete[] slots;
+
+        numCities = other.numCities;
+        nameCapacity = other.nameCapacity;
+        names = new String[nameCapacity];
+        slotCapacity = other.slotCapacity;
+        slots = new int[slotCapacity];
+
+        for(int i{}; i < numCities; i++)
+            names[i] = other.names[i];
+        for(int i{}; i < slotCapacity; i++)
+            slots[i] = other.slots[i];
+    }
+    return *this;
+}
+
+/**
+ * Destructor
+ */
+CityTable::~CityTable()
+{
+    delete[] names;
+    delete[] slots;
+}
+
+/**
+ * hash(name, length)
+ *
+ * @param name - the city name to hash
+ * @param length - the number of characters within the name
+ * @return the 32-bit FNV-1a hash of the name
+ */
+unsigned int CityTable::hash(const char* name, int length)
+{
+    unsigned int h{2166136261u};
+    for(int i{}; i < length; i++)
+    {
+        h ^= static_cast<unsigned char>(name[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * findSlot(name, length)
+ *
+ * Probes the hash table linearly from the slot given by the hash of the
+ * name, until the slot holding the name or an empty slot is found. The
+ * table is never more than half full, so an empty slot always exists.
+ *
+ * @param name - the city name to look for
+ * @param length - the number of characters within the name
+ * @return the index of the slot holding the name, or of the empty slot the
+ *         name would be placed in
+ */
+int CityTable::findSlot(const char* name, int length) const
+{
+    int mask = slotCapacity - 1;
+    int slot = hash(name, length) & mask;
+
+    while(slots[slot] != -1)
+    {
+        const String& other{names[slots[slot]]};
+        if(other.size() == length && memcmp(other.c_str(), name, length) == 0)
+            break;
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+/**
+ * rehash()
+ *
+ * Doubles the size of the hash table and places every id into the slot
+ * given by its name within the larger table.
+ */
+void CityTable::rehash()
+{
+    delete[] slots;
+    slotCapacity *= 2;
+    slots = new int[slotCapacity];
+    for(int i{}; i < slotCapacity; i++)
+        slots[i] = -1;
+
+    for(int id{}; id < numCities; id++)
+        slots[findSlot(names[id].c_str(), names[id].size())] = id;
+}
+
+/**
+ * intern(name)
+ *
+ * @param name - the city name to look for
+ * @return the id of the name. If the name has not been seen before, it is
+ *         added to the table with the next unused id.
+ */
+int CityTable::intern(const String& name)
+{
+    return intern(name.c_str(), name.size());
+}
+
+/**
+ * intern(name, length)
+ *
+ * The name does not need to be null-terminated, so names can be looked up
+ * straight from the buffer they were read into. A String is only made for
+ * names that have not been seen before.
+ *
+ * @param name - the city name to look for
+ * @param length - the number of characters within the name
+ * @return the id of the name. If the name has not been seen before, it is
+ *         added to the table with the next unused id.
+ */
+int CityTable::intern(const char* name, int length)
+{
+    int slot = findSlot(name, length);
+    if(slots[slot] != -1)
+        return slots[slot];
+
+    //grow the reverse table
+    if(numCities == nameCapacity)
+    {
+        String* temp = new String[nameCapacity * 2];
+        for(int i{}; i < numCities; i++)
+            temp[i] = names[i];
+        delete[] names;
+        names = temp;
+        nameCapacity *= 2;
+    }
+
+    names[numCities] = String(name, length);
+    slots[slot] = numCities;
+    numCities++;
+
+    //keep the hash table at most half full
+    if(numCities * 2 > slotCapacity)
+        rehash();
+
+    return numCities - 1;
+}
+
+/**
+ * find(name)
+ *
+ * @param name - the city name to look for
+ * @return the id of the name, or -1 if the name is not within the table
+ */
+int CityTable::find(const String& name) const
+{
+    return find(name.c_str(), name.size());
+}
+
+/**
+ * find(name, length)
+ *
+ * @param name - the city name to look for, which does not need to be
+ *               null-terminated
+ * @param length - the number of characters within the name
+ * @return the id of the name, or -1 if the name is not within the table
+ */
+int CityTable::find(const char* name, int length) const
+{
+    return slots[findSlot(name, length)];
+}
+
+/**
+ * getName(id)
+ *
+ * @param id - the id of a city
+ * @return the name of the city with the id
+ * @exception out_of_range if the id is not within the table
+ */
+const String& CityTable::getName(int id) const
+{
+    if(id < 0 || id >= numCities)
+        throw std::out_of_range("CityTable::getName() - id is not in the table");
+    return names[id];
+}
+
+/**
+ * size()
+ *
+ * @return the number of names within the table
+ */
+int CityTable::size() const
+{
+    return numCities;
+}
@@ -0,0 +1,59 @@
+#ifndef CITYTABLE_H
+#define CITYTABLE_H
+
+#include <dsstring.h>
+
+/**
+ * The CityTable class gives each city name a dense integer id, numbered from
+ * 0 in the order the names are first seen, so that cities can be compared
+ * and indexed by id instead of by comparing their names.
+ *
+ * Names are looked up through an open-addressing hash table of ids, and the
+ * name of each id is kept in a reverse table, so both directions take
+ * constant time on average.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class CityTable
+{
+    private:
+        int numCities;
+        int nameCapacity;           //number of names the reverse table holds
+        String* names;              //name of each id
+        int slotCapacity;           //size of the hash table, a power of 2
+        int* slots;                 //ids within the hash table, -1 if empty
+
+        //Returns the slot holding the name, or the empty slot it would use
+        int findSlot(const char* name, int length) const;
+
+        //Doubles the size of the hash table and re-inserts every id
+        void rehash();
+
+        //Hash function for city names (FNV-1a)
+        static unsigned int hash(const char* name, int length);
+
+    public:
+
+        //Constructors and Rule of 3
+        CityTable();
+        CityTable(const CityTable& other);
+        CityTable& operator=(const CityTable& other);
+        ~CityTable();
+
+        //Returns the id of the name, adding it to the table if it is new
+        int intern(const String& name);
+        int intern(const char* name, int length);
+
+        //Returns the id of the name, or -1 if it is not within the table
+        int find(const String& name) const;
+        int find(const char* name, int length) const;
+
+        const String& getName(int id) const;
+        int size() const;
+};
+
+#endif // CITYTABLE_H
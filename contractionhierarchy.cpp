@@ -0,0 +1,377 @@
+#include "contractionhierarchy.h"
+#include <pathfinder.h>
+#include <stdexcept>
+
+//Most cities a witness search settles before giving up, when contracting a
+//city and when only estimating its importance. Giving up early only adds a
+//shortcut that was not needed, so routes are still correct.
+static const int WITNESS_LIMIT = 256;
+static const int ESTIMATE_LIMIT = 16;
+
+/**
+ * Default constructor - an empty hierarchy, which must be built before use
+ */
+ContractionHierarchy::ContractionHierarchy() : graph{nullptr}, timeTag{false},
+    numCities{0}, numShortcuts{0}, rank{nullptr}, offsets{nullptr},
+    targets{nullptr}, weights{nullptr}, middles{nullptr} {}
+
+/**
+ * Destructor
+ */
+ContractionHierarchy::~ContractionHierarchy()
+{
+    reset();
+}
+
+/**
+ * reset()
+ *
+ * Frees the hierarchy, leaving it empty.
+ */
+void ContractionHierarchy::reset()
+{
+    delete[] rank;
+    delete[] offsets;
+    delete[] targets;
+    delete[] weights;
+    delete[] middles;
+    graph = nullptr;
+    numCities = 0;
+    numShortcuts = 0;
+    rank = nullptr;
+    offsets = nullptr;
+    targets = nullptr;
+    weights = nullptr;
+    middles = nullptr;
+}
+
+/**
+ * addEdge(edges, a, b, weight, middle)
+ *
+ * Each pair of cities has at most one edge, so if there already is an edge
+ * between them it is only replaced if the new one is shorter.
+ *
+ * @param edges - the edges of each city
+ * @param a - the city at one end of the edge
+ * @param b - the city at the other end
+ * @param weight - the length of the edge
+ * @param middle - the city the edge is a shortcut through, or -1 if the edge
+ *                 is a flight
+ */
+void ContractionHierarchy::addEdge(Vector<Edge>* edges, int a, int b,
+                                   long long weight, int middle)
+{
+    for(int end{}; end < 2; end++)
+    {
+        Vector<Edge>& list{edges[a]};
+        bool found{false};
+        for(Edge& e : list)
+        {
+            if(e.to == b)
+            {
+                if(weight < e.weight)
+                {
+                    e.weight = weight;
+                    e.middle = middle;
+                }
+                found = true;
+                break;
+            }
+        }
+        if(!found)
+            list.pushBack(Edge{b, weight, middle});
+
+        std::swap(a, b);
+    }
+}
+
+/**
+ * contract(edges, witness, city, add)
+ *
+ * The edges of each city only lead to cities not yet contracted. For each
+ * pair of neighbours of the city, a witness search from one looks for a
+ * path to the other that does not pass through the city and is no longer
+ * than the path through it. A shortcut is needed for every pair without one.
+ *
+ * @param edges - the edges of each city
+ * @param witness - the search state used for the witness searches
+ * @param city - the city to contract
+ * @param add - true to add the shortcuts, false to only count them
+ * @return the number of shortcuts needed
+ */
+int ContractionHierarchy::contract(Vector<Edge>* edges, SearchSide& witness,
+                                   int city, bool add)
+{
+    //the shortcuts are only added after every pair is checked, so they do
+    //not act as witnesses for each other
+    struct Shortcut
+    {
+        int a;
+        int b;
+        long long weight;
+    };
+    Vector<Shortcut> shortcuts{};
+
+    int limitSettled = add ? WITNESS_LIMIT : ESTIMATE_LIMIT;
+    const Vector<Edge>& around{edges[city]};
+    long long longest{0};
+    for(const Edge& e : around)
+    {
+        if(e.weight > longest)
+            longest = e.weight;
+    }
+
+    for(int i{}; i < around.length(); i++)
+    {
+        int from{around[i].to};
+
+        //no path longer than the longest path through the city is needed
+        long long limit = around[i].weight + longest;
+        witness.start(from);
+        int settled{0};
+        while(!witness.queue.isEmpty() && settled < limitSettled)
+        {
+            SearchLabel label{witness.queue.pop()};
+            if(label.distance > witness.distance[label.city])
+                continue;
+            if(label.distance > limit)
+                break;
+            settled++;
+
+            for(const Edge& e : edges[label.city])
+            {
+                if(e.to == city)
+                    continue;
+
+                long long dist = label.distance + e.weight;
+                if(!witness.hasReached(e.to) || dist < witness.distance[e.to])
+                {
+                    witness.reached.visit(e.to, witness.epoch);
+                    witness.distance[e.to] = dist;
+                    witness.queue.push(SearchLabel{dist, e.to});
+                }
+            }
+        }
+
+        for(int j{i + 1}; j < around.length(); j++)
+        {
+            int to{around[j].to};
+            long long via = around[i].weight + around[j].weight;
+            if(!witness.hasReached(to) || witness.distance[to] > via)
+                shortcuts.pushBack(Shortcut{from, to, via});
+        }
+    }
+
+    if(add)
+    {
+        for(const Shortcut& s : shortcuts)
+            addEdge(edges, s.a, s.b, s.weight, city);
+    }
+    return shortcuts.length();
+}
+
+/**
+ * build(graph, timeTag)
+ *
+ * Contracts every city of the graph. Cities wait in a heap ordered by their
+ * importance, which is only recomputed when a city reaches the top: if it
+ * has become more important than the next city, it goes back into the heap.
+ *
+ * @param graph - the flight schedule, which must outlive the hierarchy
+ * @param timeTag - true to weigh flights by time, false by cost in cents
+ */
+void ContractionHierarchy::build(const FlightGraph& graph, bool timeTag)
+{
+    reset();
+    this->graph = &graph;
+    this->timeTag = timeTag;
+    numCities = graph.getNumCities();
+
+    Vector<Edge>* edges = new Vector<Edge>[numCities];
+    int* deleted = new int[numCities];
+    for(int c{}; c < numCities; c++)
+    {
+        deleted[c] = 0;
+        for(int f = graph.firstFlight(c); f < graph.endFlight(c); f++)
+        {
+            if(graph.getTarget(f) != c)
+                addEdge(edges, c, graph.getTarget(f), graph.getWeight(f, timeTag), -1);
+        }
+    }
+
+    SearchSide witness(numCities);
+    auto importance = [&](int city)
+    {
+        return static_cast<long long>(contract(edges, witness, city, false))
+                - edges[city].length() + deleted[city];
+    };
+
+    Heap<SearchLabel> order{};
+    for(int c{}; c < numCities; c++)
+        order.push(SearchLabel{importance(c), c});
+
+    rank = new int[numCities];
+    int contractedSoFar{0};
+    while(!order.isEmpty())
+    {
+        int city{order.pop().city};
+        long long current = importance(city);
+        if(!order.isEmpty() && current > order.peek().distance)
+        {
+            order.push(SearchLabel{current, city});
+            continue;
+        }
+
+        numShortcuts += contract(edges, witness, city, true);
+        rank[city] = contractedSoFar++;
+
+        //the city leaves the lists of its neighbours, so its own list is
+        //left holding only the edges up the hierarchy
+        for(const Edge& e : edges[city])
+        {
+            Vector<Edge>& list{edges[e.to]};
+            for(int i{}; i < list.length(); i++)
+            {
+                if(list[i].to == city)
+                {
+                    list[i] = list.back();
+                    list.popBack();
+                    break;
+                }
+            }
+            deleted[e.to]++;
+        }
+    }
+
+    //copy the edges up the hierarchy into arrays
+    offsets = new int[numCities + 1];
+    offsets[0] = 0;
+    for(int c{}; c < numCities; c++)
+        offsets[c + 1] = offsets[c] + edges[c].length();
+
+    targets = new int[offsets[numCities]];
+    weights = new long long[offsets[numCities]];
+    middles = new int[offsets[numCities]];
+    for(int c{}; c < numCities; c++)
+    {
+        int edge{offsets[c]};
+        for(const Edge& e : edges[c])
+        {
+            targets[edge] = e.to;
+            weights[edge] = e.weight;
+            middles[edge] = e.middle;
+            edge++;
+        }
+    }
+
+    delete[] edges;
+    delete[] deleted;
+}
+
+/**
+ * findEdge(a, b)
+ *
+ * @param a - the city at one end of the edge
+ * @param b - the city at the other end
+ * @return the upward edge between the cities, from whichever has the lower
+ *         rank, or -1 if there is no edge between them
+ */
+int ContractionHierarchy::findEdge(int a, int b) const
+{
+    int lower = (rank[a] < rank[b]) ? a : b;
+    int higher = (lower == a) ? b : a;
+
+    for(int e = offsets[lower]; e < offsets[lower + 1]; e++)
+    {
+        if(targets[e] == higher)
+            return e;
+    }
+    return -1;
+}
+
+/**
+ * unpack(from, to, route)
+ *
+ * Replaces each shortcut by the two edges it skips until only flights are
+ * left, which are added to the route in order from one city to the other.
+ * Where there is more than one flight between two cities, the first of the
+ * shortest ones within the schedule is taken.
+ *
+ * @param from - the city the edge is travelled from
+ * @param to - the city the edge is travelled to
+ * @param route - the route to add the flights to
+ * @exception logic_error if there is no edge between the cities
+ */
+void ContractionHierarchy::unpack(int from, int to, Route& route) const
+{
+    //pairs of cities still to unpack, with the next pair on top
+    Vector<int> pending{};
+    pending.pushBack(to);
+    pending.pushBack(from);
+
+    while(!pending.empty())
+    {
+        int a{pending.popBack()};
+        int b{pending.popBack()};
+        int edge = findEdge(a, b);
+        if(edge == -1)
+            throw std::logic_error("ContractionHierarchy::unpack() - no edge between the cities");
+
+        if(middles[edge] != -1)
+        {
+            int middle{middles[edge]};
+            pending.pushBack(b);
+            pending.pushBack(middle);
+            pending.pushBack(middle);
+            pending.pushBack(a);
+            continue;
+        }
+
+        int flight{-1};
+        for(int f = graph->firstFlight(a); f < graph->endFlight(a) && flight == -1; f++)
+        {
+            if(graph->getTarget(f) == b && graph->getWeight(f, timeTag) == weights[edge])
+                flight = f;
+        }
+        if(flight == -1)
+            throw std::logic_error("ContractionHierarchy::unpack() - no flight between the cities");
+        route.addLeg(flight);
+    }
+}
+
+/**
+ * isBuilt()
+ * @return true if the hierarchy has been built
+ */
+bool ContractionHierarchy::isBuilt() const
+{
+    return graph != nullptr;
+}
+
+/**
+ * getTimeTag()
+ * @return true if the hierarchy weighs flights by time, false if by cost
+ */
+bool ContractionHierarchy::getTimeTag() const
+{
+    return timeTag;
+}
+
+/**
+ * getNumShortcuts()
+ * @return the number of shortcuts added while contracting the graph
+ */
+int ContractionHierarchy::getNumShortcuts() const
+{
+    return numShortcuts;
+}
+
+/**
+ * getRank(city)
+ * @param city - the id of a city
+ * @return the order the city was contracted in, from 0
+ */
+int ContractionHierarchy::getRank(int city) const
+{
+    return rank[city];
+}
@@ -0,0 +1,103 @@
+#ifndef CONTRACTIONHIERARCHY_H
+#define CONTRACTIONHIERARCHY_H
+
+#include <flightgraph.h>
+#include <route.h>
+#include <vector.h>
+
+struct SearchSide;
+
+/**
+ * The ContractionHierarchy class is a preprocessed copy of a FlightGraph for
+ * one metric (duration, or cost in cents), which lets the best route between
+ * two cities be found by searching only a small part of the graph.
+ *
+ * Cities are contracted one at a time, least important first. Contracting
+ * a city removes it from the graph, adding a shortcut between each pair of
+ * its neighbours whose only shortest connection ran through it, so that
+ * distances between the cities left are unchanged. The importance of a city
+ * is how many more edges contracting it would add than remove, plus how many
+ * of its neighbours have already been contracted, so the graph stays sparse
+ * and contraction is spread evenly across it.
+ *
+ * Each city is given a rank in the order it was contracted, and only the
+ * edges leading to a city of higher rank are kept. Because every flight is
+ * a round trip, the same upward edges serve searches from both the origin
+ * and the destination, which meet at the highest city of the best route.
+ * Every shortcut remembers the city it was made by contracting, so a route
+ * of shortcuts can be unpacked into the flights it stands for.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class ContractionHierarchy
+{
+    private:
+
+        //An edge of the graph while it is being contracted
+        struct Edge
+        {
+            int to;                 //city at the other end
+            long long weight;       //length of the edge
+            int middle;             //city the shortcut skips, -1 if a flight
+        };
+
+        const FlightGraph* graph;   //graph the hierarchy was built from
+        bool timeTag;               //time if true, cost if false
+        int numCities;
+        int numShortcuts;
+        int* rank;                  //order each city was contracted in
+        int* offsets;               //first upward edge of each city
+        int* targets;               //city each upward edge leads to
+        long long* weights;         //length of each upward edge
+        int* middles;               //city each upward edge skips, or -1
+
+        //Frees the hierarchy
+        void reset();
+
+        //Adds an edge both ways, or shortens the edge already there
+        static void addEdge(Vector<Edge>* edges, int a, int b,
+                            long long weight, int middle);
+
+        //Finds the shortcuts needed to contract a city, adding them if asked
+        static int contract(Vector<Edge>* edges, SearchSide& witness,
+                            int city, bool add);
+
+        //Returns the upward edge between two cities, or -1 if none
+        int findEdge(int a, int b) const;
+
+    public:
+
+        //Constructors
+        ContractionHierarchy();
+        ContractionHierarchy(const ContractionHierarchy& other) = delete;
+        ContractionHierarchy& operator=(const ContractionHierarchy& other) = delete;
+        ~ContractionHierarchy();
+
+        //Contracts the graph, weighing flights by time or by cost
+        void build(const FlightGraph& graph, bool timeTag);
+
+        //Adds the flights that an upward edge stands for to the route
+        void unpack(int from, int to, Route& route) const;
+
+        //Getters
+        bool isBuilt() const;
+        bool getTimeTag() const;
+        int getNumShortcuts() const;
+        int getRank(int city) const;
+
+        //The accessors below are used by every step of a query, so they are
+        //defined within the class to be inlined
+
+        //Upward edges of a city are numbered [firstEdge, endEdge)
+        int firstEdge(int city) const { return offsets[city]; }
+        int endEdge(int city) const { return offsets[city + 1]; }
+
+        int getTarget(int edge) const { return targets[edge]; }
+        long long getWeight(int edge) const { return weights[edge]; }
+};
+
+#endif // CONTRACTIONHIERARCHY_H
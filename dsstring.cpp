@@ -4,31 +4,74 @@
 
 
 /**
- * Default constructor for the String
+ * Default constructor for the String - an empty String within the inline
+ * buffer
  */
-String::String() : length{0}, arr{new char[length+1]} {}
+String::String() : length{0}, capacity{INLINE_CAPACITY}, arr{buffer}
+{
+    buffer[0] = '\0';
+}
 
 
 /**
  * Constructor using const char array to get data
  */
-String::String(const char* c) : length{static_cast<int>(strlen(c))}, arr{new char[length+1]}
+String::String(const char* c) : String()
 {
-    strcpy(arr, c); //uses strcpy from cstring to copy
+    assign(c, static_cast<int>(strlen(c)));
+}
+
+/**
+ * Constructor using the first len characters of a char array, which does
+ * not need to be null-terminated
+ *
+ * @param c - the characters to copy
+ * @param len - the number of characters to copy
+ */
+String::String(const char* c, int len) : String()
+{
+    assign(c, len);
 }
 
 /**
  * Copy constructor
  *
+ * The stored length of the other String is used, rather than measuring it
+ * again with strlen.
+ *
  * @param s - String to copy information from
  */
-String::String(const String& s) : length{static_cast<int>(strlen(s.c_str()))}, arr{new char[length+1]}
+String::String(const String& s) : String()
 {
-    const char* ptr = s.c_str();
-    strcpy(arr, ptr);
+    assign(s.arr, s.length);
 }
 
 
+/**
+ * Move constructor
+ *
+ * Takes the heap array of the other String, or copies its inline buffer.
+ * The other String is left empty.
+ *
+ * @param s - String to move information from
+ */
+String::String(String&& s) noexcept : String()
+{
+    if(s.arr == s.buffer)
+        memcpy(buffer, s.buffer, s.length + 1);
+    else
+    {
+        arr = s.arr;
+        capacity = s.capacity;
+        s.arr = s.buffer;
+        s.capacity = INLINE_CAPACITY;
+    }
+    length = s.length;
+
+    s.length = 0;
+    s.buffer[0] = '\0';
+}
+
 /**
  * Copy assignment operator
  *
@@ -37,14 +80,42 @@ String::String(const String& s) : length{static_cast<int>(strlen(s.c_str()))}, a
  */
 String& String::operator= (const String& s)
 {
-    delete[] arr;
+    if(this != &s)
+        assign(s.arr, s.length);
 
-    length = s.length;
-    const char* ptr = s.c_str();
-    arr = new char[length+1];
+    return *this;
+}
+
+/**
+ * Move assignment operator
+ *
+ * Takes the heap array of the other String, or copies its inline buffer.
+ * The other String is left empty.
+ *
+ * @param s - String to move information from
+ * @return *this - a reference to this String with the new data
+ */
+String& String::operator= (String&& s) noexcept
+{
+    if(this == &s)
+        return *this;
 
-    strcpy(arr, ptr);
+    if(s.arr == s.buffer)
+        assign(s.arr, s.length);
+    else
+    {
+        if(arr != buffer)
+            delete[] arr;
+        arr = s.arr;
+        capacity = s.capacity;
+        length = s.length;
+
+        s.arr = s.buffer;
+        s.capacity = INLINE_CAPACITY;
+    }
 
+    s.length = 0;
+    s.buffer[0] = '\0';
     return *this;
 }
 
@@ -57,14 +128,37 @@ String& String::operator= (const String& s)
  */
 String& String::operator= (const char* c)
 {
-    delete[] arr;
+    assign(c, static_cast<int>(strlen(c)));
 
-    length = strlen(c);
-    arr = new char[length + 1];
+    return *this;
+}
 
-    strcpy(arr, c);
+/**
+ * assign(c, len)
+ *
+ * Replaces the characters of the String. The current array is reused if it
+ * can hold the new characters, and otherwise a larger array is allocated on
+ * the heap. The characters may come from this String's own array.
+ *
+ * @param c - the characters to copy, which do not need to be null-terminated
+ * @param len - the number of characters to copy
+ */
+void String::assign(const char* c, int len)
+{
+    if(len > capacity)
+    {
+        char* temp = new char[len + 1];
+        memcpy(temp, c, len);
+        if(arr != buffer)
+            delete[] arr;
+        arr = temp;
+        capacity = len;
+    }
+    else
+        memmove(arr, c, len);
 
-    return *this;
+    arr[len] = '\0';
+    length = len;
 }
 
 
@@ -77,13 +171,13 @@ int String::size() const
 }
 
 /**
- * Deletes the array and resets all variables to their original state
+ * Resets the String to a length of 0. Any heap array is kept, so the
+ * String can be refilled without allocating.
  */
 void String::clear()
 {
-    delete[] arr;
     length = 0;
-    arr = new char[length];
+    arr[0] = '\0';
 }
 
 /**
@@ -181,16 +275,7 @@ String String::substring(int start, int end)
     if(e < s)
         throw std::logic_error("end index is greater than start index in substring");
 
-    int subLength = e-s;                //create new array to contain the partial string
-    char c[subLength+1]{};
-
-    for(int i{}; i < subLength; i++)
-    {
-        c[i] = arr[s+i];
-    }
-    c[subLength] = '\0';
-
-    return String(c);
+    return String(arr + s, e - s);
 }
 
 
@@ -261,11 +346,19 @@ bool String::operator> (const String& rhs) const
  */
 String String::operator+(const String& rhs)
 {
-    int nLength = rhs.length + length;
-    char nString[nLength+1];
-    strcpy(nString, arr);
-    strcat(nString, rhs.c_str());
-    return String(nString);
+    //builds the result in its own array, which is moved out when returned
+    String result{};
+    int total = length + rhs.length;
+    if(total > result.capacity)
+    {
+        result.arr = new char[total + 1];
+        result.capacity = total;
+    }
+
+    memcpy(result.arr, arr, length);
+    memcpy(result.arr + length, rhs.arr, rhs.length + 1);
+    result.length = total;
+    return result;
 }
 
 
@@ -440,7 +533,7 @@ std::ostream& operator<<(std::ostream& o, const String& str)
  */
 String::~String()
 {
-    if(arr != nullptr)
+    if(arr != buffer)
     {
         delete[] arr;
     }
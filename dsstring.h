@@ -15,8 +15,13 @@
  * the std::string class provides.
  *
  * The class is implemented through cstring manipulation, so the
- * the only two member variables are an array of characters and
- * the length of the array.
+ * member variables are an array of characters, the length of the array,
+ * and the number of characters the array can hold.
+ *
+ * Strings of up to 23 characters (which covers almost every city name) are
+ * kept within a small buffer inside the String itself, and only longer
+ * Strings allocate their array on the heap. Either way, the array is always
+ * null-terminated, so c_str() can be passed to cstring functions.
  *
 */
 
@@ -24,18 +29,29 @@ class String
 {
     private:
 
+        //Longest String that fits within the inline buffer
+        static const int INLINE_CAPACITY = 23;
+
         int length;
-        char* arr;
+        int capacity;                       //characters arr can hold
+        char* arr;                          //buffer, or a heap array
+        char buffer[INLINE_CAPACITY + 1];
+
+        //Replaces the characters, growing the array if needed
+        void assign(const char* c, int len);
 
     public:
 
         // Constructors, including copy constructors
         String();
         String(const char*);
+        String(const char*, int);
         String(const String&);
+        String(String&&) noexcept;
 
-        // operator= to satisfy the Rule of Three
+        // operator= to satisfy the Rule of Three, and move assignment
         String& operator= (const String&);
+        String& operator= (String&&) noexcept;
         String& operator= (const char*);
 
 
@@ -1,51 +1,81 @@
 #include <flightdata.h>
+#include <mappedfile.h>
 
 /**
- * Constructor with char*
- * @param dataText - the name of the file name to open and parse data from.
- * @exception invalid_argument if the file does not exist
+ * Default constructor
  */
-FlightData::FlightData(char* dataText)
+FlightData::FlightData() : originPool{}, destinationPool{},
+    flights{&originPool}, cities{}, origins{new Origin*[16]}, capacity{16} {}
+
+/**
+ * Copy constructor
+ *
+ * The copied Destination objects are pointed at the Origin objects of the
+ * new list, rather than the list they were copied from.
+ *
+ * @param data - the FlightData object to copy the schedule from
+ */
+FlightData::FlightData(const FlightData& data) : originPool{},
+    destinationPool{}, flights{&originPool}, cities{}, origins{nullptr},
+    capacity{0}
 {
-    //open the data file
-    std::ifstream dataFile;
-    dataFile.open(dataText);
+    flights = data.flights;
+    index();
+}
 
-    //throw exception if the file doesn't exist
-    if(!dataFile.is_open())
+/**
+ * operator= overload (to satisfy Rule of 3)
+ * @param data - the FlightData object to copy the schedule from
+ * @return a reference to this FlightData object, containing the new schedule
+ */
+FlightData& FlightData::operator=(const FlightData& data)
+{
+    if(this != &data)
     {
-        throw std::invalid_argument("File is not open or cannot be found.");
+        flights = data.flights;
+        index();
     }
+    return *this;
+}
+
+/**
+ * Destructor
+ */
+FlightData::~FlightData()
+{
+    delete[] origins;
+}
+
+/**
+ * Constructor with char*
+ *
+ * The file is mapped into memory and its fields are read in place, so city
+ * names are only copied into Strings the first time they are seen.
+ *
+ * @param dataText - the name of the file name to open and parse data from.
+ * @exception invalid_argument if the file does not exist
+ */
+FlightData::FlightData(char* dataText) : originPool{}, destinationPool{},
+    flights{&originPool}, cities{}, origins{new Origin*[16]}, capacity{16}
+{
+    //map the data file, throwing an exception if it doesn't exist
+    MappedFile dataFile(dataText);
 
     //get the number of flights to iterate through
-    int numFlights{};
-    dataFile >> numFlights;
-    dataFile.ignore();                      //ignore newline character
-
-    //initializing the origin, destination, cost, and duration strings,
-    //as well as a double for cost and an integer duration
-    String orig{}, dest{}, cos{}, dur{};
-    double cost{};
-    int duration{};
-
-    //pull data from the data file, using an overloaded version of the
-    //getline function for String
-    for(int i{}; i < numFlights; i++)
-    {
-        getline(dataFile, orig, '|');
-        getline(dataFile, dest, '|');
-        getline(dataFile, cos, '|');
-        getline(dataFile, dur);
+    int numFlights{dataFile.nextInt()};
 
-        //Truncate any result to 2 decimal places and return to cost
-        cost  = atof(cos.c_str());
-        duration = atoi(dur.c_str());
+    //pull data from the data file, one pipe-delimited flight per line
+    for(int i{}; i < numFlights && !dataFile.atEnd(); i++)
+    {
+        std::string_view orig{dataFile.nextField('|')};
+        std::string_view dest{dataFile.nextField('|')};
+        double cost{dataFile.nextDouble('|')};
+        int duration{dataFile.nextInt()};
 
         //Add information to the schedule
-        addRoundTrip(orig, dest, cost, duration);
+        addRoundTrip(addCity(orig.data(), orig.size()),
+                     addCity(dest.data(), dest.size()), cost, duration);
     }
-    dataFile.close();
-
 }
 
 /**
@@ -57,6 +87,19 @@ LinkedList<Origin> FlightData::getFlights() const
     return flights;
 }
 
+/**
+ * getSchedule()
+ *
+ * Unlike getFlights(), the list is not copied, so the Origin pointers held
+ * by each Destination point into the returned list.
+ *
+ * @return a reference to the list of Origin objects
+ */
+LinkedList<Origin>& FlightData::getSchedule()
+{
+    return flights;
+}
+
 /**
  * setFlights(value)
  * @param value - the linked list of Origin cities to change ot the flights
@@ -64,6 +107,99 @@ LinkedList<Origin> FlightData::getFlights() const
 void FlightData::setFlights(const LinkedList<Origin>& value)
 {
     flights = value;
+    index();
+}
+
+/**
+ * getCities()
+ * @return the table of ids given to each city within the schedule
+ */
+const CityTable& FlightData::getCities() const
+{
+    return cities;
+}
+
+/**
+ * getOrigin(id)
+ * @param id - the id of a city within the schedule
+ * @return a pointer to the Origin object of the city within the list
+ * @exception out_of_range if the id is not within the schedule
+ */
+const Origin* FlightData::getOrigin(int id) const
+{
+    if(id < 0 || id >= flights.length())
+        throw std::out_of_range("FlightData::getOrigin() - id is not in the schedule");
+    return origins[id];
+}
+
+/**
+ * addCity(name, length)
+ *
+ * Looks up the id of the city. Ids are given out in the order cities are
+ * first seen, so a new city has an id equal to the length of the list, and
+ * its Origin is added to the end of the list.
+ *
+ * @param name - the name of the city, which does not need to be
+ *               null-terminated
+ * @param length - the number of characters within the name
+ * @return a pointer to the Origin object of the city within the list
+ */
+Origin* FlightData::addCity(const char* name, int length)
+{
+    int id = cities.intern(name, length);
+
+    if(id == flights.length())
+    {
+        flights.emplaceBack(cities.getName(id), id);
+        flights.back().getDestinations().setPool(&destinationPool);
+
+        //grow the index of Origin pointers
+        if(id == capacity)
+        {
+            Origin** temp = new Origin*[capacity * 2];
+            for(int i{}; i < capacity; i++)
+                temp[i] = origins[i];
+            delete[] origins;
+            origins = temp;
+            capacity *= 2;
+        }
+        origins[id] = &flights.back();
+    }
+
+    return origins[id];
+}
+
+/**
+ * index()
+ *
+ * Rebuilds the CityTable and the index of Origin pointers from the flights
+ * list, giving each Origin an id in list order, and points each Destination
+ * at the Origin with the same name within the list.
+ */
+void FlightData::index()
+{
+    cities = CityTable();
+    delete[] origins;
+    capacity = (flights.length() > 16) ? flights.length() : 16;
+    origins = new Origin*[capacity];
+
+    for(Node<Origin>* n = flights.getHead(); n != nullptr; n = n->getNext())
+    {
+        Origin& orig{n->getData()};
+        orig.setId(cities.intern(orig.getName()));
+        origins[orig.getId()] = &orig;
+    }
+
+    for(Node<Origin>* n = flights.getHead(); n != nullptr; n = n->getNext())
+    {
+        LinkedList<Destination>& dests{n->getData().getDestinations()};
+        for(Node<Destination>* d = dests.getHead(); d != nullptr; d = d->getNext())
+        {
+            Destination& dest{d->getData()};
+            dest.setId(cities.find(dest.getName()));
+            dest.setOriginPtr((dest.getId() != -1) ? origins[dest.getId()] : nullptr);
+        }
+    }
 }
 
 /**
@@ -83,27 +219,30 @@ void FlightData::setFlights(const LinkedList<Origin>& value)
  */
 void FlightData::addRoundTrip(String city1, String city2, double cost, int duration)
 {
-    //adds the Origin objects to the linked list and returns
-    //the indices of their existence within the list
-    int index1 = flights.uniquePushBack(Origin(city1));
-    int index2 = flights.uniquePushBack(Origin(city2));
-
-    //Gets the pointers for each city, so they can be added
-    //as data pointers to each Destination object
-    Origin* ptr1 = flights.getDataPointer(index1);
-    Origin* ptr2 = flights.getDataPointer(index2);
-
-    //Creation of destination objects
-    Destination d1(city2, cost, duration, ptr2);
-    Destination d2(city1, cost, duration, ptr1);
+    //Gets the pointers for each city, adding the Origin objects to the
+    //linked list if the cities are new, so they can be added as data
+    //pointers to each Destination object
+    addRoundTrip(addCity(city1.c_str(), city1.size()),
+                 addCity(city2.c_str(), city2.size()), cost, duration);
+}
 
+/**
+ * addRoundTrip() with Origin pointers
+ *
+ * @param ptr1 - the Origin object of one of the cities
+ * @param ptr2 - the Origin object of the other city
+ * @param cost - the cost of the flight
+ * @param duration - the duration of the flight
+ */
+void FlightData::addRoundTrip(Origin* ptr1, Origin* ptr2, double cost, int duration)
+{
     //Pull references of the destination lists from each Origin object
     LinkedList<Destination>& dests1 = ptr1->getDestinations();
     LinkedList<Destination>& dests2 = ptr2->getDestinations();
 
-    //pushes back each destination to each list
-    dests1.pushBack(d1);
-    dests2.pushBack(d2);
+    //constructs each destination within the node at the end of each list
+    dests1.emplaceBack(ptr2->getName(), cost, duration, ptr2);
+    dests2.emplaceBack(ptr1->getName(), cost, duration, ptr1);
 }
 
 
@@ -142,18 +281,16 @@ std::ostream& operator<<(std::ostream& o, const FlightData& d)
     o << "\nFLIGHTS" << std::endl;
     int totalFlights{0};
 
-    //Gets the list of origins
-    LinkedList<Origin> origins = d.getFlights();
-
-    //Iterates through all of the origins
-    for(int i{}; i < origins.length(); i++)
+    //Iterates through all of the origins, walking the nodes of the list
+    //rather than indexing it
+    for(Node<Origin>* n = d.flights.getHead(); n != nullptr; n = n->getNext())
     {
         //get origin city name
-        String originCity = origins.get(i).getName();
-        o << originCity;
+        Origin& orig{n->getData()};
+        o << orig.getName();
 
         //get destinations
-        LinkedList<Destination> dests = origins.get(i).getDestinations();
+        LinkedList<Destination>& dests{orig.getDestinations()};
         o << " (" << dests.length() << " flights)\n";
         totalFlights += dests.length();
 
@@ -165,10 +302,10 @@ std::ostream& operator<<(std::ostream& o, const FlightData& d)
         o << std::endl;
 
         //Iterate through destinations
-        for(int j{}; j < dests.length(); j++)
+        for(Node<Destination>* m = dests.getHead(); m != nullptr; m = m->getNext())
         {
             //Get destination reference and output relevant data
-            Destination& d = dests[j];
+            Destination& d{m->getData()};
             o << std::left;
             o << "-> "  << std::setw(25) << d.getName();
             o << "" << std::setw(15) << d.getCost();
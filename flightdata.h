@@ -3,6 +3,7 @@
 
 #include <linkedlist.h>
 #include <city.h>
+#include <citytable.h>
 #include <iomanip>
 #include <iostream>
 #include <city.h>
@@ -13,8 +14,14 @@
  * by the flight data file provided. The data is parsed within a linked list
  * of Origin objects (which each contain a linked list of Destination objects).
  *
- * The file is parsed within the constructor, and all data is placed into the
- * flights LinkedList.
+ * The file is mapped into memory and parsed in place within the constructor,
+ * and all data is placed into the flights LinkedList. Each city name is
+ * given an id by a CityTable, and the Origin of each id is indexed, so
+ * adding a flight takes constant time instead of searching the list for its
+ * cities.
+ *
+ * The Nodes of the schedule are allocated from NodePools owned by this
+ * object, which are declared before the flights list so they outlive it.
  *
  * This class will be used in the Sprint4: Flight Planner project
  * in SMU CSE 2341.
@@ -25,18 +32,37 @@
 class FlightData
 {
     private:
+        NodePool<Origin> originPool;                    //Nodes of flights
+        NodePool<Destination> destinationPool;          //Nodes of each Origin
         LinkedList<Origin> flights;                     //flight schedule
+        CityTable cities;                               //ids of the cities
+        Origin** origins;                               //Origin of each id
+        int capacity;                                   //size of origins
+
+        //Returns the Origin of the city, adding it to the schedule if new
+        Origin* addCity(const char* name, int length);
+
+        //Adds a flight each way between two Origin objects
+        void addRoundTrip(Origin* ptr1, Origin* ptr2, double cost, int duration);
+
+        //Gives ids to the cities of the flights list and indexes them
+        void index();
 
     public:
 
-        //Constructors
-        FlightData() : flights{} {}
-        FlightData(const FlightData& data) : flights{data.flights}{}
+        //Constructors and Rule of 3
+        FlightData();
+        FlightData(const FlightData& data);
+        FlightData& operator=(const FlightData& data);
         FlightData(char* dataFile);
+        ~FlightData();
 
-        //Getter and setter
+        //Getters and setter
         LinkedList<Origin> getFlights() const;
+        LinkedList<Origin>& getSchedule();
         void setFlights(const LinkedList<Origin>& value);
+        const CityTable& getCities() const;
+        const Origin* getOrigin(int id) const;
 
         //Adds two flights to the flights linkedlist
         void addRoundTrip(String orig, String dest, double cost, int duration);
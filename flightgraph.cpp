@@ -0,0 +1,434 @@
+#include "flightgraph.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//Marks the start of a snapshot, and its layout
+static const unsigned int SNAPSHOT_MAGIC = 0x48505247;  //"GRPH"
+static const unsigned int SNAPSHOT_VERSION = 1;
+
+//Arrays within a snapshot, in the order they are written
+enum Section
+{
+    OFFSETS,
+    TARGETS,
+    COSTS,
+    DURATIONS,
+    CENTS,
+    NAME_OFFSETS,           //first character of each name within NAMES
+    NAMES,
+    NUM_SECTIONS
+};
+
+//Start of a snapshot. The header and every section are a whole number of
+//8-byte words long, so each array is aligned within the mapping
+struct SnapshotHeader
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned long long checksum;        //of every byte after the header
+    long long fileSize;
+    int numCities;
+    int numFlights;
+    long long sections[NUM_SECTIONS];   //byte offset of each array
+};
+
+/**
+ * sectionSize(section, numCities, numFlights, namesLength)
+ *
+ * @param section - an array within a snapshot
+ * @param numCities - the number of cities of the graph
+ * @param numFlights - the number of flights of the graph
+ * @param namesLength - the number of characters of every name together
+ * @return the number of bytes the array holds, not counting padding
+ */
+static long long sectionSize(int section, int numCities, int numFlights,
+                             long long namesLength)
+{
+    long long cities{numCities}, flights{numFlights};
+    switch(section)
+    {
+        case OFFSETS:       return sizeof(int) * (cities + 1);
+        case TARGETS:       return sizeof(int) * flights;
+        case COSTS:         return sizeof(double) * flights;
+        case DURATIONS:     return sizeof(int) * flights;
+        case CENTS:         return sizeof(long long) * flights;
+        case NAME_OFFSETS:  return sizeof(long long) * (cities + 1);
+        default:            return namesLength;
+    }
+}
+
+/**
+ * padded(size)
+ *
+ * @param size - a number of bytes
+ * @return the size rounded up to a whole number of 8-byte words
+ */
+static long long padded(long long size)
+{
+    return (size + 7) & ~7LL;
+}
+
+/**
+ * checksum(hash, bytes, length)
+ *
+ * Mixes the bytes into the hash a word at a time, with a partial last word
+ * padded with zeros the same way it is within a snapshot. Checksumming each
+ * section in turn gives the same hash as checksumming the whole file after
+ * the header at once.
+ *
+ * @param hash - the hash of the bytes before these
+ * @param bytes - the bytes to mix in
+ * @param length - the number of bytes
+ * @return the hash of the bytes so far
+ */
+static unsigned long long checksum(unsigned long long hash, const char* bytes,
+                                   long long length)
+{
+    auto mix = [&hash](unsigned long long word)
+    {
+        hash = (hash ^ word) * 1099511628211ULL;
+        hash ^= hash >> 29;
+    };
+
+    long long words = length / 8;
+    for(long long i{}; i < words; i++)
+    {
+        unsigned long long word{};
+        memcpy(&word, bytes + i * 8, 8);
+        mix(word);
+    }
+    if(length % 8 != 0)
+    {
+        unsigned long long word{0};
+        memcpy(&word, bytes + words * 8, length % 8);
+        mix(word);
+    }
+    return hash;
+}
+
+/**
+ * Default constructor - an empty graph
+ */
+FlightGraph::FlightGraph() : numCities{0}, numFlights{0}, cities{},
+    offsets{new int[1]{0}}, targets{nullptr}, costs{nullptr},
+    durations{nullptr}, cents{nullptr}, mapping{nullptr}, mappedSize{0} {}
+
+/**
+ * Constructor with FlightData&
+ *
+ * Copies the schedule into the graph arrays. The destination list of each
+ * Origin is walked once to count its flights, and once more to copy them.
+ *
+ * @param data - the parsed flight schedule
+ */
+FlightGraph::FlightGraph(FlightData& data) : numCities{0}, numFlights{0},
+    cities{data.getCities()}, offsets{nullptr}, targets{nullptr}, costs{nullptr},
+    durations{nullptr}, cents{nullptr}, mapping{nullptr}, mappedSize{0}
+{
+    LinkedList<Origin>& schedule{data.getSchedule()};
+    numCities = schedule.length();
+
+    offsets = new int[numCities + 1];
+
+    //count the flights leaving each city
+    offsets[0] = 0;
+    for(Node<Origin>* n = schedule.getHead(); n != nullptr; n = n->getNext())
+    {
+        Origin& orig{n->getData()};
+        offsets[orig.getId() + 1] = orig.getDestinations().length();
+    }
+    for(int i{}; i < numCities; i++)
+        offsets[i + 1] += offsets[i];
+
+    numFlights = offsets[numCities];
+    targets = new int[numFlights];
+    costs = new double[numFlights];
+    durations = new int[numFlights];
+    cents = new long long[numFlights];
+
+    //copy the flights of each city, in the order of its destination list
+    for(Node<Origin>* n = schedule.getHead(); n != nullptr; n = n->getNext())
+    {
+        Origin& orig{n->getData()};
+        int flight = offsets[orig.getId()];
+
+        LinkedList<Destination>& dests{orig.getDestinations()};
+        for(Node<Destination>* d = dests.getHead(); d != nullptr; d = d->getNext())
+        {
+            Destination& dest{d->getData()};
+            targets[flight] = dest.getOriginPtr()->getId();
+            costs[flight] = dest.getCost();
+            durations[flight] = dest.getDuration();
+            cents[flight] = std::llround(dest.getCost() * 100);
+            flight++;
+        }
+    }
+}
+
+/**
+ * Destructor
+ */
+FlightGraph::~FlightGraph()
+{
+    reset();
+}
+
+/**
+ * reset()
+ *
+ * Frees the arrays, or unmaps the snapshot they are within, leaving no
+ * arrays at all. The caller gives the graph new arrays.
+ */
+void FlightGraph::reset()
+{
+    if(mapping != nullptr)
+        munmap(mapping, mappedSize);
+    else
+    {
+        delete[] offsets;
+        delete[] targets;
+        delete[] costs;
+        delete[] durations;
+        delete[] cents;
+    }
+    offsets = nullptr;
+    targets = nullptr;
+    costs = nullptr;
+    durations = nullptr;
+    cents = nullptr;
+    mapping = nullptr;
+    mappedSize = 0;
+    numCities = 0;
+    numFlights = 0;
+}
+
+/**
+ * findCity(name)
+ *
+ * @param name - the name of the city to look for
+ * @return the id of the city, or -1 if the city is not within the graph
+ */
+int FlightGraph::findCity(const String& name) const
+{
+    return cities.find(name);
+}
+
+/**
+ * getNumCities()
+ * @return the number of cities within the graph
+ */
+int FlightGraph::getNumCities() const
+{
+    return numCities;
+}
+
+/**
+ * getNumFlights()
+ * @return the number of flights within the graph, counting each direction
+ *         of a round trip
+ */
+int FlightGraph::getNumFlights() const
+{
+    return numFlights;
+}
+
+/**
+ * getName(city)
+ * @param city - the id of the city
+ * @return the name of the city
+ */
+const String& FlightGraph::getName(int city) const
+{
+    return cities.getName(city);
+}
+
+/**
+ * getCities()
+ * @return the ids of the cities within the graph
+ */
+const CityTable& FlightGraph::getCities() const
+{
+    return cities;
+}
+
+/**
+ * save(fileName)
+ *
+ * The snapshot is written in the byte order of this machine, since it is
+ * only meant to be loaded again by the same program. A snapshot written on
+ * a machine of the other byte order has a different magic number, so it is
+ * never loaded.
+ *
+ * @param fileName - the file to save the snapshot to
+ * @return true if the file was written, false otherwise
+ */
+bool FlightGraph::save(const char* fileName) const
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if(!file)
+        return false;
+
+    //the names are written one after another, found by their offsets
+    long long* nameOffsets = new long long[numCities + 1];
+    nameOffsets[0] = 0;
+    for(int c{}; c < numCities; c++)
+        nameOffsets[c + 1] = nameOffsets[c] + cities.getName(c).size();
+    char* names = new char[nameOffsets[numCities] + 1];
+    for(int c{}; c < numCities; c++)
+        memcpy(names + nameOffsets[c], cities.getName(c).c_str(),
+               nameOffsets[c + 1] - nameOffsets[c]);
+
+    const char* arrays[NUM_SECTIONS]{
+        reinterpret_cast<const char*>(offsets), reinterpret_cast<const char*>(targets),
+        reinterpret_cast<const char*>(costs), reinterpret_cast<const char*>(durations),
+        reinterpret_cast<const char*>(cents), reinterpret_cast<const char*>(nameOffsets),
+        names};
+
+    SnapshotHeader header{};
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.numCities = numCities;
+    header.numFlights = numFlights;
+    header.checksum = 0;
+    long long end{sizeof(SnapshotHeader)};
+    for(int s{}; s < NUM_SECTIONS; s++)
+    {
+        long long size{sectionSize(s, numCities, numFlights, nameOffsets[numCities])};
+        header.sections[s] = end;
+        header.checksum = checksum(header.checksum, arrays[s], size);
+        end += padded(size);
+    }
+    header.fileSize = end;
+
+    const char zeros[8]{};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for(int s{}; s < NUM_SECTIONS; s++)
+    {
+        long long size{sectionSize(s, numCities, numFlights, nameOffsets[numCities])};
+        file.write(arrays[s], size);
+        file.write(zeros, padded(size) - size);
+    }
+
+    delete[] nameOffsets;
+    delete[] names;
+    return static_cast<bool>(file);
+}
+
+/**
+ * load(fileName)
+ *
+ * Maps the snapshot read-only, and points the arrays of the graph into the
+ * mapping, so the flights are never copied or parsed. The sections are
+ * found by their offsets within the header, each checked to lie within the
+ * file, and the checksum is checked before anything is used. The names of
+ * the cities are then given their ids by a new CityTable.
+ *
+ * @param fileName - the file the snapshot was saved to
+ * @return true if the snapshot was loaded, false if the file does not
+ *         exist, is not a snapshot of this version, or is damaged, in which
+ *         case the graph is left as it was
+ */
+bool FlightGraph::load(const char* fileName)
+{
+    int fd = open(fileName, O_RDONLY);
+    if(fd == -1)
+        return false;
+
+    struct stat info;
+    if(fstat(fd, &info) == -1 ||
+            info.st_size < static_cast<off_t>(sizeof(SnapshotHeader)))
+    {
+        close(fd);
+        return false;
+    }
+
+    void* map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED)
+        return false;
+
+    char* base = static_cast<char*>(map);
+    long long size{info.st_size};
+    SnapshotHeader header{};
+    memcpy(&header, base, sizeof(header));
+
+    //every section must lie within the file before any of it is read
+    bool valid{header.magic == SNAPSHOT_MAGIC &&
+               header.version == SNAPSHOT_VERSION && header.fileSize == size &&
+               header.numCities >= 0 && header.numFlights >= 0};
+    auto fits = [&](int s, long long namesLength)
+    {
+        long long start{header.sections[s]};
+        return start >= static_cast<long long>(sizeof(SnapshotHeader)) &&
+               start % 8 == 0 && start <= size &&
+               sectionSize(s, header.numCities, header.numFlights,
+                           namesLength) <= size - start;
+    };
+    for(int s{}; valid && s < NAMES; s++)
+        valid = fits(s, 0);
+
+    const long long* nameOffsets{nullptr};
+    const int* fileOffsets{nullptr};
+    if(valid)
+    {
+        nameOffsets = reinterpret_cast<const long long*>(base + header.sections[NAME_OFFSETS]);
+        fileOffsets = reinterpret_cast<const int*>(base + header.sections[OFFSETS]);
+        valid = nameOffsets[0] == 0 && nameOffsets[header.numCities] >= 0 &&
+                fits(NAMES, nameOffsets[header.numCities]) &&
+                checksum(0, base + sizeof(SnapshotHeader),
+                         size - sizeof(SnapshotHeader)) == header.checksum &&
+                fileOffsets[0] == 0 && fileOffsets[header.numCities] == header.numFlights;
+    }
+
+    //the names are given ids in the order they were saved
+    CityTable table{};
+    const char* names{base + (valid ? header.sections[NAMES] : 0)};
+    for(int c{}; valid && c < header.numCities; c++)
+    {
+        long long length{nameOffsets[c + 1] - nameOffsets[c]};
+        valid = length >= 0 && nameOffsets[c + 1] <= nameOffsets[header.numCities] &&
+                table.intern(names + nameOffsets[c], static_cast<int>(length)) == c;
+    }
+
+    if(!valid)
+    {
+        munmap(map, size);
+        return false;
+    }
+
+    reset();
+    mapping = base;
+    mappedSize = size;
+    numCities = header.numCities;
+    numFlights = header.numFlights;
+    cities = table;
+    offsets = reinterpret_cast<int*>(base + header.sections[OFFSETS]);
+    targets = reinterpret_cast<int*>(base + header.sections[TARGETS]);
+    costs = reinterpret_cast<double*>(base + header.sections[COSTS]);
+    durations = reinterpret_cast<int*>(base + header.sections[DURATIONS]);
+    cents = reinterpret_cast<long long*>(base + header.sections[CENTS]);
+    return true;
+}
+
+/**
+ * isSnapshot(fileName)
+ *
+ * A text schedule starts with the number of flights, so it never starts
+ * with the magic number of a snapshot.
+ *
+ * @param fileName - the name of a file
+ * @return true if the file starts with the magic number of a snapshot,
+ *         false if it does not or cannot be read
+ */
+bool FlightGraph::isSnapshot(const char* fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    unsigned int magic{};
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    return file && magic == SNAPSHOT_MAGIC;
+}
@@ -0,0 +1,102 @@
+#ifndef FLIGHTGRAPH_H
+#define FLIGHTGRAPH_H
+
+#include <flightdata.h>
+#include <dsstring.h>
+#include <citytable.h>
+
+/**
+ * The FlightGraph class is a frozen, compact copy of the flight schedule
+ * held by a FlightData object, built once after the schedule is parsed and
+ * used by the searches in place of the linked lists of Origin and
+ * Destination objects.
+ *
+ * Cities are numbered by the id given to them by the CityTable of the
+ * FlightData, which the graph keeps a copy of, and the flights are stored in
+ * compressed sparse row form: the flights leaving city c are the flights
+ * numbered from offsets[c] up to (but not including) offsets[c+1], in the
+ * same order as the destination list of the city. The city each flight
+ * arrives at, its cost and its duration are each kept in their own array,
+ * so a search scans contiguous memory instead of following list nodes.
+ *
+ * The graph can be saved to a binary snapshot, so a schedule is parsed
+ * once and every later run maps the snapshot into memory instead. The
+ * snapshot holds each array of the graph and the names of the cities, each
+ * found by its byte offset from the start of the file, so nothing within
+ * it depends on where it is mapped. A loaded graph searches the flight
+ * arrays in place within the mapping; only the names of the cities are
+ * copied out, into the CityTable. The file starts with a version number
+ * and a checksum of everything after its header, so snapshots of another
+ * layout, or that were cut short or damaged, are never loaded.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class FlightGraph
+{
+    private:
+        int numCities;
+        int numFlights;
+        CityTable cities;           //name of each city
+        int* offsets;               //first flight of each city
+        int* targets;               //city each flight arrives at
+        double* costs;              //cost of each flight
+        int* durations;             //duration of each flight
+        long long* cents;           //cost of each flight in whole cents
+        char* mapping;              //snapshot the arrays are within, or null
+        long long mappedSize;       //size of the snapshot in bytes
+
+        //Frees the arrays, leaving an empty graph
+        void reset();
+
+    public:
+
+        //Constructors
+        FlightGraph();
+        FlightGraph(FlightData& data);
+        FlightGraph(const FlightGraph& other) = delete;
+        FlightGraph& operator=(const FlightGraph& other) = delete;
+        ~FlightGraph();
+
+        //Returns the id of the city with the given name, or -1 if not found
+        int findCity(const String& name) const;
+
+        //Size of the graph
+        int getNumCities() const;
+        int getNumFlights() const;
+
+        const String& getName(int city) const;
+        const CityTable& getCities() const;
+
+        //Saves a snapshot of the graph, returning false if it cannot be written
+        bool save(const char* fileName) const;
+
+        //Maps a snapshot, returning false if it is missing or damaged
+        bool load(const char* fileName);
+
+        //Returns true if the file starts like a snapshot
+        static bool isSnapshot(const char* fileName);
+
+        //The accessors below are used by every step of a search, so they
+        //are defined within the class to be inlined
+
+        //Flights leaving a city are numbered [firstFlight, endFlight)
+        int firstFlight(int city) const { return offsets[city]; }
+        int endFlight(int city) const { return offsets[city + 1]; }
+
+        int getTarget(int flight) const { return targets[flight]; }
+        double getCost(int flight) const { return costs[flight]; }
+        int getDuration(int flight) const { return durations[flight]; }
+
+        //Returns the duration of a flight if timeTag is set, or its cost in
+        //cents otherwise
+        long long getWeight(int flight, bool timeTag) const
+        {
+            return timeTag ? durations[flight] : cents[flight];
+        }
+};
+
+#endif // FLIGHTGRAPH_H
@@ -1,4 +1,5 @@
 #include "flightplans.h"
+#include <cmath>
 
 /**
  * Default constructor
@@ -6,12 +7,13 @@
 FlightPlans::FlightPlans() : plans{}, request{} {}
 
 /**
- * Constructor with LinkedList<Plan> and Request
- * @param p - a linked list of plans that specify different ways of
- *            journeying from an origin and destination
+ * Constructor with Vector<Plan> and Request
+ * @param p - a vector of plans that specify different ways of
+ *            journeying from an origin and destination, which is moved into
+ *            the FlightPlans
  * @param r - the request, containing the user's choice of origin & destination
  */
-FlightPlans::FlightPlans(LinkedList<Plan> p, Request r) : plans{p}, request{r}
+FlightPlans::FlightPlans(Vector<Plan> p, Request r) : plans{std::move(p)}, request{std::move(r)}
 {
     sort();
 }
@@ -21,7 +23,38 @@ FlightPlans::FlightPlans(LinkedList<Plan> p, Request r) : plans{p}, request{r}
  * @param plans - the FlightPlans reference to copy data from
  */
 FlightPlans::FlightPlans(const FlightPlans& plans)
-    : plans{plans.getPlans()}, request{plans.getRequest()}{}
+    : plans{plans.plans}, request{plans.request}{}
+
+/**
+ * Move constructor
+ * @param plans - the FlightPlans reference to move data from
+ */
+FlightPlans::FlightPlans(FlightPlans&& plans) noexcept
+    : plans{std::move(plans.plans)}, request{std::move(plans.request)}{}
+
+/**
+ * operator= overload (to satisfy Rule of 3)
+ * @param plans - the FlightPlans reference to copy data from
+ * @return a reference to this FlightPlans object, containing the new data
+ */
+FlightPlans& FlightPlans::operator=(const FlightPlans& plans)
+{
+    this->plans = plans.plans;
+    request = plans.request;
+    return *this;
+}
+
+/**
+ * Move assignment operator
+ * @param plans - the FlightPlans reference to move data from
+ * @return a reference to this FlightPlans object, containing the new data
+ */
+FlightPlans& FlightPlans::operator=(FlightPlans&& plans) noexcept
+{
+    this->plans = std::move(plans.plans);
+    request = std::move(plans.request);
+    return *this;
+}
 
 /**
  * Sorts the linked list of Plan objects using the checkByTag function,
@@ -38,25 +71,26 @@ void FlightPlans::sort()
     //true if sorting by time, false if cost
     bool sortTag{request.getTimeTag()};
 
-    int j{};                                   //uses int to find index to swap
+    int j{};                                   //index the plan is moved to
     Plan t{};                                  //temp variable
     for(int i{1}; i < plans.length(); i++)
     {
-        //Uses the checkByTag function as the comparison
-        for(j = i; j > 0 && checkByTag(sortTag, plans[j-1], plans[j]); j--)
+        //Uses the checkByTag function as the comparison, shifting each
+        //later plan up by one instead of swapping
+        t = std::move(plans[i]);
+        for(j = i; j > 0 && checkByTag(sortTag, plans[j-1], t); j--)
         {
-            t = plans[j];                     //swap data
-            plans[j] = plans[j-1];
-            plans[j-1] = t;
+            plans[j] = std::move(plans[j-1]);
         }
+        plans[j] = std::move(t);
     }
 }
 
 /**
  * getPlans()
- * @return the linked list of Plan objects
+ * @return a reference to the vector of Plan objects
  */
-LinkedList<Plan> FlightPlans::getPlans() const
+const Vector<Plan>& FlightPlans::getPlans() const
 {
     return plans;
 }
@@ -64,9 +98,9 @@ LinkedList<Plan> FlightPlans::getPlans() const
 /**
  * setPlans(value)
  *
- * @param value - the linked list to set "plans" to
+ * @param value - the vector to set "plans" to
  */
-void FlightPlans::setPlans(const LinkedList<Plan>& value)
+void FlightPlans::setPlans(const Vector<Plan>& value)
 {
     plans = value;
 }
@@ -95,7 +129,8 @@ void FlightPlans::setRequest(const Request& value)
  * checkByTag returns a boolean based on whether the tag given is
  * true or false. If the tag is true, then the function will compare
  * the duration of each Plan object. Otherwise, it will compare the
- * cost of each Plan object.
+ * cost of each Plan object, rounded to the cent, so that plans with the same
+ * cost keep their order no matter how their totals were rounded.
  * @param tag - the determinant of the comparison. If true, the function will
  *              compare the duration, otherwise it will compare the cost
  * @param lhs - the Plan object to compare with rhs
@@ -109,7 +144,8 @@ bool FlightPlans::checkByTag(bool tag, const Plan& lhs, const Plan& rhs)
         return lhs.getTotalDuration() > rhs.getTotalDuration();
     }
     else
-        return lhs.getTotalCost() > rhs.getTotalCost();
+        return std::llround(lhs.getTotalCost() * 100) >
+                std::llround(rhs.getTotalCost() * 100);
 }
 
 /**
@@ -1,12 +1,12 @@
 #ifndef FLIGHTPLANS_H
 #define FLIGHTPLANS_H
 
-#include <linkedlist.h>
+#include <vector.h>
 #include <request.h>
 #include <plan.h>
 
 /**
- * The FlightPlans class uses a linked list of Plan objects and a Request object
+ * The FlightPlans class uses a Vector of Plan objects and a Request object
  * that delineates the requested origin and destination, and a list of
  * flight schedules that will bring someone from the origin to the destination.
  *
@@ -20,22 +20,25 @@ class FlightPlans
 {
     private:
 
-        LinkedList<Plan> plans;     // list of flights
+        Vector<Plan> plans;         // list of flights
         Request request;            // the flight request
 
     public:
 
         //Constructor
         FlightPlans();
-        FlightPlans(LinkedList<Plan> p, Request r);
+        FlightPlans(Vector<Plan> p, Request r);
         FlightPlans(const FlightPlans& plans);
+        FlightPlans(FlightPlans&& plans) noexcept;
+        FlightPlans& operator=(const FlightPlans& plans);
+        FlightPlans& operator=(FlightPlans&& plans) noexcept;
 
         //Sort based on the tag given by the request
         void sort();
 
         //getter and setter
-        LinkedList<Plan> getPlans() const;
-        void setPlans(const LinkedList<Plan>& value);
+        const Vector<Plan>& getPlans() const;
+        void setPlans(const Vector<Plan>& value);
 
         Request getRequest() const;
         void setRequest(const Request& value);
@@ -7,15 +7,16 @@ FlightRequests::FlightRequests() : requests{} {}
 
 
 /**
- * Constructor with char*
+ * Constructor with char*, CityTable&
  *
  * Uses the file name within the parameter to parse the user request data
- * into a LinkedList of Request objects.
+ * into a Vector of Request objects.
  *
  * @param requestText - the data file containing the user's flight requests
+ * @param cities - the ids of the cities within the flight schedule
  * @exception invalid_argument if the file does not exist
  */
-FlightRequests::FlightRequests(char* requestText)
+FlightRequests::FlightRequests(char* requestText, const CityTable& cities)
 {
     //Open the file
     std::ifstream requestFile;
@@ -31,32 +32,55 @@ FlightRequests::FlightRequests(char* requestText)
     int numReqs{};
     requestFile >> numReqs;
     requestFile.ignore();
+    requests.reserve(numReqs);
 
+    //Adds a request object to the vector for each line
+    Request r{};
+    for(int i{}; i < numReqs && readRequest(requestFile, cities, r); i++)
+        requests.pushBack(r);
+}
+
+/**
+ * readRequest(in, cities, r)
+ *
+ * Reads a single request line, "origin|destination|tag", so requests can
+ * also be read one at a time as they are solved.
+ *
+ * @param in - the stream to read the request from
+ * @param cities - the ids of the cities within the flight schedule
+ * @param r - set to the request that was read
+ * @return true if a request was read, false if the stream had already
+ *         ended
+ */
+bool FlightRequests::readRequest(std::istream& in, const CityTable& cities,
+                                 Request& r)
+{
     //Strings for the tag, origin, and destination, and a bool to convert
     // the String t to a boolean for the Request object
     String t{}, orig{}, dest{};
     bool tag;
-    for(int i{}; i < numReqs; i++)
-    {
-        //Pull data using getline and delimiters
-        getline(requestFile, orig, '|');
-        getline(requestFile, dest, '|');
-        getline(requestFile, t, '\n');
 
-        //Convert String t to a bool tag depending on the character at the end
-        tag = (t == "T") ? true : false;
+    if(in.peek() == std::char_traits<char>::eof())
+        return false;
 
-        //Adds a request object to the linked list
-        requests.pushBack(Request(orig, dest, tag));
-    }
+    //Pull data using getline and delimiters
+    getline(in, orig, '|');
+    getline(in, dest, '|');
+    getline(in, t, '\n');
+
+    //Convert String t to a bool tag depending on the character at the end
+    tag = (t == "T") ? true : false;
+
+    r = Request(orig, dest, tag, cities.find(orig), cities.find(dest));
+    return true;
 }
 
 /**
  * getRequests()
  *
- * @return the LinkedList of Request objects
+ * @return a reference to the Vector of Request objects
  */
-LinkedList<Request> FlightRequests::getRequests() const
+const Vector<Request>& FlightRequests::getRequests() const
 {
     return requests;
 }
@@ -64,9 +88,9 @@ LinkedList<Request> FlightRequests::getRequests() const
 /**
  * setRequests(value)
  *
- * @param value - the linked list of request objects to set "requests" to
+ * @param value - the vector of request objects to set "requests" to
  */
-void FlightRequests::setRequests(const LinkedList<Request>& value)
+void FlightRequests::setRequests(const Vector<Request>& value)
 {
     requests = value;
 }
@@ -95,7 +119,7 @@ std::ostream& operator<< (std::ostream& o, const FlightRequests& fr)
     for(int i{}; i < fr.requests.length(); i++)
     {
         //Gets the request
-        Request r = fr.requests.get(i);
+        const Request& r{fr.requests[i]};
 
         o << std::right;
         o << std::setw(25) << r.getOrigin();
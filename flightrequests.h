@@ -5,16 +5,18 @@
 #include <iomanip>
 #include <fstream>
 #include <request.h>
-#include <linkedlist.h>
+#include <vector.h>
 #include <dsstring.h>
+#include <citytable.h>
 
 
 /**
  * The FlightRequests class contains a list of Request objects that will
  * be used to determine the list of flight plans that will be outputted
  * to the output file. The class takes a request data file and parses it
- * in the constructor and creates a linked list of Request objects that
- * the Output class will use to find flights.
+ * in the constructor and creates a Vector of Request objects that
+ * the Output class will use to find flights. The cities of each Request are
+ * given the ids they have within the CityTable of the flight schedule.
  *
  * This class will be used in the Sprint4: Flight Planner project
  * in SMU CSE 2341.
@@ -26,17 +28,21 @@
 class FlightRequests
 {
     private:
-        LinkedList<Request> requests;
+        Vector<Request> requests;
 
     public:
 
         //Constructors
         FlightRequests();
-        FlightRequests(char* requestText);
+        FlightRequests(char* requestText, const CityTable& cities);
+
+        //Reads the next request line, returning false at the end of the stream
+        static bool readRequest(std::istream& in, const CityTable& cities,
+                                Request& r);
 
         //getters and setters
-        LinkedList<Request> getRequests() const;
-        void setRequests(const LinkedList<Request>& value);
+        const Vector<Request>& getRequests() const;
+        void setRequests(const Vector<Request>& value);
 
         //operator<< overload
         friend std::ostream& operator<< (std::ostream& o, const FlightRequests& fr);
@@ -0,0 +1,271 @@
+#ifndef HEAP
+#define HEAP
+
+#include <stdexcept>
+#include <utility>
+
+/**
+ * The Heap class provides an implementation of a binary min-heap, which
+ * returns the smallest element that has been pushed into it. The Heap is
+ * stored within a contiguous, growable array, where the children of the
+ * element at index i are stored at indices 2i+1 and 2i+2.
+ *
+ * Elements are compared with operator<, so any type that defines
+ * operator< can be placed within the Heap.
+ *
+ * The Heap class will be used as the priority queue for the shortest path
+ * searches in the Sprint4: Flight Planner project in SMU CSE2341.
+ *
+ * By: Oisin Coveney
+ * Created:         October 17, 2026
+ * Last Modified:   October 17, 2026
+ */
+template<class T>
+class Heap
+{
+    public:
+        //Rule of 3 + constructors
+        Heap();
+        Heap(const Heap& other);
+        Heap& operator=(const Heap& other);
+        ~Heap();
+
+        void push(T d);
+        T pop();
+        T& peek();
+        bool isEmpty() const;
+        int size() const;
+        void clear();
+
+    private:
+        T* data;            //array of elements, ordered as a binary heap
+        int length;         //number of elements within the heap
+        int capacity;       //number of elements the array can hold
+
+        void grow();
+        void siftUp(int index);
+        void siftDown(int index);
+};
+
+
+/**
+ * Default constructor
+ */
+template<class T>
+Heap<T>::Heap() : data{nullptr}, length{0}, capacity{0} {}
+
+/**
+ * Copy constructor
+ *
+ * @param other : the Heap to copy elements from
+ */
+template<class T>
+Heap<T>::Heap(const Heap& other)
+    : data{nullptr}, length{other.length}, capacity{other.length}
+{
+    if(capacity > 0)
+    {
+        data = new T[capacity];
+        for(int i{}; i < length; i++)
+            data[i] = other.data[i];
+    }
+}
+
+/**
+ * Copy assignment operator
+ *
+ * @param other : the Heap to copy elements from
+ * @return a reference to this Heap, containing the elements of other
+ */
+template<class T>
+Heap<T>& Heap<T>::operator=(const Heap& other)
+{
+    if(this != &other)
+    {
+        delete[] data;
+        data = nullptr;
+        length = other.length;
+        capacity = other.length;
+
+        if(capacity > 0)
+        {
+            data = new T[capacity];
+            for(int i{}; i < length; i++)
+                data[i] = other.data[i];
+        }
+    }
+    return *this;
+}
+
+/**
+ * Destructor
+ */
+template<class T>
+Heap<T>::~Heap()
+{
+    delete[] data;
+}
+
+/**
+ * push(T d)
+ *
+ * Adds an element to the heap, moving it up the heap until its parent is
+ * no longer larger than it.
+ *
+ * @param d : the element to add to the heap
+ */
+template<class T>
+void Heap<T>::push(T d)
+{
+    if(length == capacity)
+        grow();
+
+    data[length] = std::move(d);
+    siftUp(length);
+    length++;
+}
+
+/**
+ * pop()
+ *
+ * Removes the smallest element of the heap. The last element of the heap
+ * replaces the smallest element, and is moved down until the heap is
+ * ordered again.
+ *
+ * @return the smallest element within the heap
+ * @exception out_of_range if the heap is empty
+ */
+template<class T>
+T Heap<T>::pop()
+{
+    if(length == 0)
+        throw std::out_of_range("Heap<T>::pop() - heap is empty");
+
+    T top = std::move(data[0]);
+    length--;
+    if(length > 0)
+    {
+        data[0] = std::move(data[length]);
+        siftDown(0);
+    }
+    return top;
+}
+
+/**
+ * peek()
+ *
+ * @return a reference to the smallest element within the heap
+ * @exception out_of_range if the heap is empty
+ */
+template<class T>
+T& Heap<T>::peek()
+{
+    if(length == 0)
+        throw std::out_of_range("Heap<T>::peek() - heap is empty");
+    return data[0];
+}
+
+/**
+ * isEmpty()
+ *
+ * @return true if the heap is empty (size = 0), false if not
+ */
+template<class T>
+bool Heap<T>::isEmpty() const
+{
+    return length == 0;
+}
+
+/**
+ * size()
+ *
+ * @return the number of elements within the heap
+ */
+template<class T>
+int Heap<T>::size() const
+{
+    return length;
+}
+
+/**
+ * clear()
+ *
+ * Removes all elements from the heap. The array is kept, so a cleared
+ * heap can be refilled without reallocating.
+ */
+template<class T>
+void Heap<T>::clear()
+{
+    length = 0;
+}
+
+/**
+ * grow()
+ *
+ * Doubles the capacity of the underlying array, moving all elements into
+ * the new array.
+ */
+template<class T>
+void Heap<T>::grow()
+{
+    int newCapacity = (capacity == 0) ? 16 : capacity * 2;
+    T* temp = new T[newCapacity];
+
+    for(int i{}; i < length; i++)
+        temp[i] = std::move(data[i]);
+
+    delete[] data;
+    data = temp;
+    capacity = newCapacity;
+}
+
+/**
+ * siftUp(int index)
+ *
+ * Moves the element at the index up the heap, swapping it with its parent
+ * while it is smaller than its parent.
+ *
+ * @param index : the index of the element to move
+ */
+template<class T>
+void Heap<T>::siftUp(int index)
+{
+    T d = std::move(data[index]);
+    while(index > 0)
+    {
+        int parent = (index - 1) / 2;
+        if(!(d < data[parent]))
+            break;
+        data[index] = std::move(data[parent]);
+        index = parent;
+    }
+    data[index] = std::move(d);
+}
+
+/**
+ * siftDown(int index)
+ *
+ * Moves the element at the index down the heap, swapping it with its
+ * smallest child while that child is smaller than it.
+ *
+ * @param index : the index of the element to move
+ */
+template<class T>
+void Heap<T>::siftDown(int index)
+{
+    T d = std::move(data[index]);
+    int child = 2 * index + 1;
+    while(child < length)
+    {
+        if(child + 1 < length && data[child + 1] < data[child])
+            child++;
+        if(!(data[child] < d))
+            break;
+        data[index] = std::move(data[child]);
+        index = child;
+        child = 2 * index + 1;
+    }
+    data[index] = std::move(d);
+}
+
+#endif
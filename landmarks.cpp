@@ -0,0 +1,300 @@
+#include "landmarks.h"
+#include <pathfinder.h>
+#include <fstream>
+#include <limits>
+
+const long long Landmarks::UNREACHABLE = std::numeric_limits<long long>::max();
+
+//Marks the start of a landmark file, and its layout
+static const unsigned int FILE_MAGIC = 0x4b4d444c;     //"LDMK"
+static const unsigned int FILE_VERSION = 1;
+
+/**
+ * Default constructor - no landmarks, so every lower bound is 0
+ */
+Landmarks::Landmarks() : numLandmarks{0}, numCities{0}, cities{nullptr},
+    durations{nullptr}, cents{nullptr} {}
+
+/**
+ * Destructor
+ */
+Landmarks::~Landmarks()
+{
+    reset();
+}
+
+/**
+ * reset()
+ *
+ * Frees the tables, leaving no landmarks.
+ */
+void Landmarks::reset()
+{
+    delete[] cities;
+    delete[] durations;
+    delete[] cents;
+    cities = nullptr;
+    durations = nullptr;
+    cents = nullptr;
+    numLandmarks = 0;
+    numCities = 0;
+}
+
+/**
+ * distancesFrom(graph, city, timeTag, row)
+ *
+ * Runs Dijkstra's algorithm outward from the city over the whole graph.
+ *
+ * @param graph - the flight schedule
+ * @param city - the id of the city to find the distances from
+ * @param timeTag - true to weigh flights by time, false by cost in cents
+ * @param row - set to the distance of each city, or UNREACHABLE
+ */
+void Landmarks::distancesFrom(const FlightGraph& graph, int city, bool timeTag,
+                              long long* row)
+{
+    for(int i{}; i < graph.getNumCities(); i++)
+        row[i] = UNREACHABLE;
+
+    Heap<SearchLabel> queue{};
+    row[city] = 0;
+    queue.push(SearchLabel{0, city});
+
+    while(!queue.isEmpty())
+    {
+        SearchLabel label{queue.pop()};
+        if(label.distance > row[label.city])
+            continue;
+
+        int end = graph.endFlight(label.city);
+        for(int f = graph.firstFlight(label.city); f < end; f++)
+        {
+            int next = graph.getTarget(f);
+            long long dist = label.distance + graph.getWeight(f, timeTag);
+            if(dist < row[next])
+            {
+                row[next] = dist;
+                queue.push(SearchLabel{dist, next});
+            }
+        }
+    }
+}
+
+/**
+ * checksum(graph)
+ *
+ * @param graph - the flight schedule
+ * @return the 64-bit FNV-1a hash of the size of the graph, and the city,
+ *         duration and cost in cents of every flight in order
+ */
+unsigned long long Landmarks::checksum(const FlightGraph& graph)
+{
+    unsigned long long hash{14695981039346656037ULL};
+    auto mix = [&hash](long long value)
+    {
+        for(int i{}; i < 8; i++)
+        {
+            hash ^= static_cast<unsigned long long>(value >> (i * 8)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    mix(graph.getNumCities());
+    mix(graph.getNumFlights());
+    for(int c{}; c < graph.getNumCities(); c++)
+    {
+        mix(graph.endFlight(c));
+        for(int f = graph.firstFlight(c); f < graph.endFlight(c); f++)
+        {
+            mix(graph.getTarget(f));
+            mix(graph.getWeight(f, true));
+            mix(graph.getWeight(f, false));
+        }
+    }
+    return hash;
+}
+
+/**
+ * build(graph, numLandmarks)
+ *
+ * Chooses the landmarks by duration, each the city farthest from those
+ * already chosen (cities that cannot be reached are skipped), and fills the
+ * tables of both durations and costs from them.
+ *
+ * @param graph - the flight schedule
+ * @param numLandmarks - the largest number of landmarks to choose
+ */
+void Landmarks::build(const FlightGraph& graph, int numLandmarks)
+{
+    reset();
+    numCities = graph.getNumCities();
+    if(numLandmarks > numCities)
+        numLandmarks = numCities;
+    if(numLandmarks <= 0)
+        return;
+
+    cities = new int[numLandmarks];
+    durations = new long long[static_cast<long long>(numLandmarks) * numCities];
+    cents = new long long[static_cast<long long>(numLandmarks) * numCities];
+
+    //distance from city 0 picks the first landmark, and then the distance
+    //from the nearest landmark picks each one after it
+    long long* nearest = new long long[numCities];
+    distancesFrom(graph, 0, true, nearest);
+
+    for(int l{}; l < numLandmarks; l++)
+    {
+        int farthest{-1};
+        for(int c{}; c < numCities; c++)
+        {
+            if(nearest[c] != UNREACHABLE &&
+                    (farthest == -1 || nearest[c] > nearest[farthest]))
+                farthest = c;
+        }
+
+        //every reachable city is already a landmark
+        if(farthest == -1 || (l > 0 && nearest[farthest] == 0))
+            break;
+
+        long long* row = durations + static_cast<long long>(l) * numCities;
+        cities[l] = farthest;
+        distancesFrom(graph, farthest, true, row);
+        distancesFrom(graph, farthest, false,
+                      cents + static_cast<long long>(l) * numCities);
+        this->numLandmarks++;
+
+        for(int c{}; c < numCities; c++)
+        {
+            if(l == 0 || row[c] < nearest[c])
+                nearest[c] = row[c];
+        }
+    }
+    delete[] nearest;
+}
+
+/**
+ * load(fileName, graph)
+ *
+ * @param fileName - the file the tables were saved to
+ * @param graph - the flight schedule the tables must have been built for
+ * @return true if the tables were loaded, false if the file does not exist,
+ *         is damaged, or was saved for a different schedule, in which case
+ *         there are no landmarks
+ */
+bool Landmarks::load(const char* fileName, const FlightGraph& graph)
+{
+    reset();
+    std::ifstream file(fileName, std::ios::binary);
+    if(!file)
+        return false;
+
+    unsigned int magic{}, version{};
+    unsigned long long sum{};
+    int fileCities{}, fileLandmarks{};
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&sum), sizeof(sum));
+    file.read(reinterpret_cast<char*>(&fileCities), sizeof(fileCities));
+    file.read(reinterpret_cast<char*>(&fileLandmarks), sizeof(fileLandmarks));
+
+    if(!file || magic != FILE_MAGIC || version != FILE_VERSION ||
+            fileCities != graph.getNumCities() || fileLandmarks < 0 ||
+            fileLandmarks > fileCities || sum != checksum(graph))
+        return false;
+
+    long long cells = static_cast<long long>(fileLandmarks) * fileCities;
+    cities = new int[fileLandmarks];
+    durations = new long long[cells];
+    cents = new long long[cells];
+    file.read(reinterpret_cast<char*>(cities), sizeof(int) * fileLandmarks);
+    file.read(reinterpret_cast<char*>(durations), sizeof(long long) * cells);
+    file.read(reinterpret_cast<char*>(cents), sizeof(long long) * cells);
+
+    if(!file)
+    {
+        reset();
+        return false;
+    }
+
+    numLandmarks = fileLandmarks;
+    numCities = fileCities;
+    return true;
+}
+
+/**
+ * save(fileName, graph)
+ *
+ * The tables are written in the byte order of this machine, since they are
+ * only meant to be loaded again by the same program.
+ *
+ * @param fileName - the file to save the tables to
+ * @param graph - the flight schedule the tables were built for
+ * @return true if the file was written, false otherwise
+ */
+bool Landmarks::save(const char* fileName, const FlightGraph& graph) const
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if(!file)
+        return false;
+
+    unsigned long long sum{checksum(graph)};
+    long long cells = static_cast<long long>(numLandmarks) * numCities;
+    file.write(reinterpret_cast<const char*>(&FILE_MAGIC), sizeof(FILE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+    file.write(reinterpret_cast<const char*>(&sum), sizeof(sum));
+    file.write(reinterpret_cast<const char*>(&numCities), sizeof(numCities));
+    file.write(reinterpret_cast<const char*>(&numLandmarks), sizeof(numLandmarks));
+    file.write(reinterpret_cast<const char*>(cities), sizeof(int) * numLandmarks);
+    file.write(reinterpret_cast<const char*>(durations), sizeof(long long) * cells);
+    file.write(reinterpret_cast<const char*>(cents), sizeof(long long) * cells);
+    return static_cast<bool>(file);
+}
+
+/**
+ * lowerBound(city, target, timeTag)
+ *
+ * Landmarks that cannot reach both cities are skipped.
+ *
+ * @param city - the id of a city
+ * @param target - the id of the city to bound the distance to
+ * @param timeTag - true for the bound in minutes, false for cents
+ * @return a distance no greater than the distance between the cities
+ */
+long long Landmarks::lowerBound(int city, int target, bool timeTag) const
+{
+    const long long* table{timeTag ? durations : cents};
+    long long bound{0};
+
+    for(int l{}; l < numLandmarks; l++)
+    {
+        const long long* row = table + static_cast<long long>(l) * numCities;
+        if(row[city] == UNREACHABLE || row[target] == UNREACHABLE)
+            continue;
+
+        long long diff = row[target] - row[city];
+        if(diff < 0)
+            diff = -diff;
+        if(diff > bound)
+            bound = diff;
+    }
+    return bound;
+}
+
+/**
+ * size()
+ * @return the number of landmarks
+ */
+int Landmarks::size() const
+{
+    return numLandmarks;
+}
+
+/**
+ * getLandmark(index)
+ * @param index - the index of a landmark, within [0, size())
+ * @return the id of the city of the landmark
+ */
+int Landmarks::getLandmark(int index) const
+{
+    return cities[index];
+}
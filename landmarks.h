@@ -0,0 +1,79 @@
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+#include <flightgraph.h>
+
+/**
+ * The Landmarks class holds the distance (in both minutes and cents) from a
+ * few landmark cities to every city of a FlightGraph, which give lower
+ * bounds on the distance between any two cities for an A* search. Since
+ * every flight is a round trip, the triangle inequality gives
+ *
+ *      distance(city, target) >= |distance(L, target) - distance(L, city)|
+ *
+ * for each landmark L, and the largest of these is used as the bound.
+ *
+ * Landmarks are chosen to be far apart: the first is the city farthest from
+ * city 0, and each one after it is the city farthest from the landmarks
+ * already chosen, so that most cities lie "behind" some landmark as seen
+ * from most others.
+ *
+ * The tables take one Dijkstra search per landmark to build, so they can be
+ * saved to a binary file next to the schedule and loaded the next time the
+ * same schedule is used. The file holds a checksum of the graph, so tables
+ * built for a different schedule are never loaded.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class Landmarks
+{
+    private:
+        int numLandmarks;
+        int numCities;
+        int* cities;                //city of each landmark
+        long long* durations;       //minutes from each landmark to each city
+        long long* cents;           //cents from each landmark to each city
+
+        //Frees the tables
+        void reset();
+
+        //Fills one row of a table with the distances from a city
+        static void distancesFrom(const FlightGraph& graph, int city,
+                                  bool timeTag, long long* row);
+
+        //Returns a checksum of the cities and flights of the graph
+        static unsigned long long checksum(const FlightGraph& graph);
+
+    public:
+
+        //Distance of the cities that cannot be reached from a landmark
+        static const long long UNREACHABLE;
+
+        //Constructors
+        Landmarks();
+        Landmarks(const Landmarks& other) = delete;
+        Landmarks& operator=(const Landmarks& other) = delete;
+        ~Landmarks();
+
+        //Chooses the landmarks and builds their tables
+        void build(const FlightGraph& graph, int numLandmarks = 8);
+
+        //Loads tables saved for the same graph, returning false if there are none
+        bool load(const char* fileName, const FlightGraph& graph);
+
+        //Saves the tables, returning false if the file cannot be written
+        bool save(const char* fileName, const FlightGraph& graph) const;
+
+        //Returns a lower bound on the distance between two cities
+        long long lowerBound(int city, int target, bool timeTag) const;
+
+        //Getters
+        int size() const;
+        int getLandmark(int index) const;
+};
+
+#endif // LANDMARKS_H
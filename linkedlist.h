@@ -1,6 +1,9 @@
 #pragma once
 #include <node.h>
+#include <nodepool.h>
 #include <iostream>
+#include <stdexcept>
+#include <utility>
 
 
 /**
@@ -12,6 +15,11 @@
  * This LinkedList is doubly-linked, and Nodes contain pointers to the next and
  * previous Nodes within the list.
  *
+ * Nodes are allocated on their own by default. A list can instead be given a
+ * NodePool, which hands out Nodes from larger slabs; the pool must outlive
+ * the list. Copies of a list allocate their own Nodes, while a moved list
+ * takes its pool along with its Nodes.
+ *
  * This LinkedList class will be used in the Sprint4: Flight Planner Project,
  * in SMU CS2341.
  *
@@ -27,6 +35,7 @@ class LinkedList
         int size{0};         //size of list
         Node<T>* head;      //beginning of the list
         Node<T>* tail;      //end of the list
+        NodePool<T>* pool;  //pool to allocate Nodes from, nullptr if none
 
 
         //Copies list from source to dest
@@ -38,12 +47,25 @@ class LinkedList
         //Returns a reference to the Node at the index
         Node<T>* cycle(int index) const;
 
+        //Links a new Node to the end of the list
+        void linkBack(Node<T>* node);
+
+        //Allocates a Node from the pool, or on its own if there is no pool
+        template<class... Args>
+        Node<T>* makeNode(Args&&... args);
+
+        //Returns a Node to wherever it was allocated from
+        void freeNode(Node<T>* node);
+
     public:
 
         //Rule of 3 + constructors
         LinkedList();                                   //default constructor
+        LinkedList(NodePool<T>* pool);                  //constructor with pool
         LinkedList(const LinkedList& list);             //copy constructor
+        LinkedList(LinkedList&& list) noexcept;         //move constructor
         LinkedList& operator=(const LinkedList& list);  //copy assignment oper.
+        LinkedList& operator=(LinkedList&& list) noexcept; //move assignment
         ~LinkedList();                                  //destructor
 
         //capacity
@@ -60,7 +82,10 @@ class LinkedList
         //modifiers
         void insert(int index, T data);
         void pushFront(T data);
-        void pushBack(T data);
+        void pushBack(const T& data);
+        void pushBack(T&& data);
+        template<class... Args>
+        void emplaceBack(Args&&... args);
         void assign(int index, T data);
         int uniquePushBack(T data);
 
@@ -84,6 +109,8 @@ class LinkedList
         void setHead(Node<T>* value);
         Node<T>* getTail() const;
         void setTail(Node<T>* value);
+        NodePool<T>* getPool() const;
+        void setPool(NodePool<T>* value);
 
         template<class S>
         friend std::ostream& operator<<(std::ostream& o, const LinkedList<S>& list);
@@ -108,12 +135,12 @@ void LinkedList<T>::listCopy(LinkedList& dest, const LinkedList& source)
     if(source.getHead() == nullptr)
         return;
 
-    dest.setHead(new Node<T>(source.getHead()->data));
+    dest.setHead(dest.makeNode(source.getHead()->data));
 
     // Size = 1 -> special case to set tail to the head
     if(source.size == 1)
     {
-        dest.setTail(head);
+        dest.setTail(dest.getHead());
     }
     // Size > 1 -> all other cases to copy all nodes to new array
     else if (source.size > 1)
@@ -127,7 +154,7 @@ void LinkedList<T>::listCopy(LinkedList& dest, const LinkedList& source)
         while(sourceTemp != nullptr)
         {
             //Node to add to list
-            Node<T>* inserted = new Node<T>(sourceTemp->data);
+            Node<T>* inserted = dest.makeNode(sourceTemp->data);
 
             //Sort all pointers with new node
             temp->next = inserted;
@@ -159,7 +186,7 @@ void LinkedList<T>::insert(Node<T>* next, T data)
     Node<T>* previous = next->previous;     //gets the node before "next"
     //for easier pointer snafu
 
-    Node<T>* addedNode = new Node<T>(data); //Node to insert
+    Node<T>* addedNode = makeNode(std::move(data)); //Node to insert
 
     if(previous != nullptr)                 //If previous = nullptr, then
     {                                       //the node is the head of the list
@@ -215,6 +242,61 @@ Node<T>*LinkedList<T>::cycle(int index) const
     return current;
 }
 
+/**
+ * linkBack(Node* node)
+ *
+ * Links a Node to the end of the list. Every function that adds to the end
+ * of the list creates its Node, and then uses this function.
+ *
+ * @param node : a new Node that is not within any list
+ */
+template<class T>
+void LinkedList<T>::linkBack(Node<T>* node)
+{
+    if(tail != nullptr)         //If list is empty
+    {
+        tail->next = node;      //sets the new Node to the end of the array
+        node->previous = tail;
+    }
+    else                        //If tail is nullptr, then the list is empty
+    {
+        head = node;
+    }
+
+    tail = node;
+
+    size++;
+}
+
+/**
+ * makeNode(args...)
+ *
+ * @param args : the arguments to pass to the constructor of the Node
+ * @return a new Node, from the pool of the list if it has one
+ */
+template<class T>
+template<class... Args>
+Node<T>* LinkedList<T>::makeNode(Args&&... args)
+{
+    if(pool != nullptr)
+        return pool->create(std::forward<Args>(args)...);
+    return new Node<T>(std::forward<Args>(args)...);
+}
+
+/**
+ * freeNode(Node* node)
+ *
+ * @param node : a Node allocated by makeNode(), which must not be used again
+ */
+template<class T>
+void LinkedList<T>::freeNode(Node<T>* node)
+{
+    if(pool != nullptr)
+        pool->destroy(node);
+    else
+        delete node;
+}
+
 
 //Constructors / Rule of 3
 
@@ -222,31 +304,91 @@ Node<T>*LinkedList<T>::cycle(int index) const
  * Default Constructor
  */
 template<class T>
-LinkedList<T>::LinkedList() :size{0}, head{nullptr}, tail{nullptr}{}
+LinkedList<T>::LinkedList() :size{0}, head{nullptr}, tail{nullptr},
+    pool{nullptr}{}
+
+/**
+ * Constructor with NodePool
+ *
+ * @param pool : the pool to allocate Nodes from, which must outlive the list
+ */
+template<class T>
+LinkedList<T>::LinkedList(NodePool<T>* pool) :size{0}, head{nullptr},
+    tail{nullptr}, pool{pool}{}
 
 /**
  * Copy constructor
  *
+ * The copy does not share the pool of the other list, since the pool may
+ * not outlive the copy, so its Nodes are allocated on their own.
+ *
  * @param list : a const list reference to copy data into this list
  */
 template<class T>
 LinkedList<T>::LinkedList(const LinkedList& list)
-    : size{list.size}, head{nullptr}, tail{nullptr}
+    : size{list.size}, head{nullptr}, tail{nullptr}, pool{nullptr}
 {
     listCopy(*this, list);
 }
 
+/**
+ * Move constructor
+ *
+ * Takes the Nodes of the other list, leaving it empty.
+ *
+ * @param list : the list to move Nodes from
+ */
+template<class T>
+LinkedList<T>::LinkedList(LinkedList&& list) noexcept
+    : size{list.size}, head{list.head}, tail{list.tail}, pool{list.pool}
+{
+    list.size = 0;
+    list.head = nullptr;
+    list.tail = nullptr;
+}
+
 /**
  * Copy assignment operator
  *
+ * The Nodes are allocated from the pool of this list, if it has one.
+ *
  * @param list : a const list reference to copy data into this list
  */
 template<class T>
 LinkedList<T>& LinkedList<T>::operator=(const LinkedList& list)
 {
-    clear();            //deletes all data in the list
-    listCopy(*this, list);
-    size = list.size;
+    if(this != &list)
+    {
+        clear();            //deletes all data in the list
+        listCopy(*this, list);
+        size = list.size;
+    }
+    return *this;
+}
+
+/**
+ * Move assignment operator
+ *
+ * Deletes the Nodes of this list and takes the Nodes (and the pool) of the
+ * other list, leaving it empty.
+ *
+ * @param list : the list to move Nodes from
+ */
+template<class T>
+LinkedList<T>& LinkedList<T>::operator=(LinkedList&& list) noexcept
+{
+    if(this != &list)
+    {
+        clear();
+        size = list.size;
+        head = list.head;
+        tail = list.tail;
+        pool = list.pool;
+
+        list.size = 0;
+        list.head = nullptr;
+        list.tail = nullptr;
+    }
     return *this;
 }
 
@@ -257,8 +399,6 @@ template<class T>
 LinkedList<T>::~LinkedList()
 {
     clear();
-    head = nullptr;
-    tail = nullptr;
 }
 
 
@@ -392,9 +532,9 @@ template<class T>
 void LinkedList<T>::insert(int index, T data)
 {
     if(index == size)
-        pushBack(data);
+        pushBack(std::move(data));
     else
-        insert(cycle(index), data);
+        insert(cycle(index), std::move(data));
 }
 
 /**
@@ -407,37 +547,53 @@ void LinkedList<T>::insert(int index, T data)
 template<class T>
 void LinkedList<T>::pushFront(T data)
 {
-    insert(0, data);
+    insert(0, std::move(data));
 }
 
 
 /**
- * pushBack(T data)
+ * pushBack(const T& data)
  *
  * Inserts an element to the end of the list. Because the insert function
  * only works with indices between [0, size-1], pushBack essentially
  * replicates an insert function for an index = size.
  *
- * @param data : data to be inserted into a Node at the end of the list
+ * @param data : data to be copied into a Node at the end of the list
  *
  */
 template<class T>
-void LinkedList<T>::pushBack(T data)
+void LinkedList<T>::pushBack(const T& data)
 {
-    Node<T>* temp = new Node<T>(data);
-    if(tail != nullptr)         //If list is empty
-    {
-        tail->next = temp;      //sets the new Node to the end of the array
-        temp->previous = tail;
-    }
-    else                        //If tail is nullptr, then the list is empty
-    {
-        head = temp;
-    }
+    linkBack(makeNode(data));
+}
 
-    tail = temp;
+/**
+ * pushBack(T&& data)
+ *
+ * Inserts an element to the end of the list, moving it into the new Node
+ * instead of copying it.
+ *
+ * @param data : data to be moved into a Node at the end of the list
+ */
+template<class T>
+void LinkedList<T>::pushBack(T&& data)
+{
+    linkBack(makeNode(std::move(data)));
+}
 
-    size++;
+/**
+ * emplaceBack(args...)
+ *
+ * Inserts an element to the end of the list, constructing it from the
+ * arguments within the new Node.
+ *
+ * @param args : the arguments to pass to the constructor of the element
+ */
+template<class T>
+template<class... Args>
+void LinkedList<T>::emplaceBack(Args&&... args)
+{
+    linkBack(makeNode(std::in_place, std::forward<Args>(args)...));
 }
 
 /**
@@ -481,7 +637,7 @@ int LinkedList<T>::uniquePushBack(T data)
             return i;
         current = current->next;
     }
-    pushBack(data);
+    pushBack(std::move(data));
     return size-1;
 }
 
@@ -530,8 +686,8 @@ T LinkedList<T>::remove(int index)
         tail = before;
     }
 
-    T returnData = current->data;       //get data to return
-    delete current;
+    T returnData = std::move(current->data);    //get data to return
+    freeNode(current);
     size--;
     return returnData;
 }
@@ -603,14 +759,23 @@ void LinkedList<T>::resize(int size, T val)
 /**
  * clear()
  *
- * Deletes all elements of the array using the popFront() function.
- *
+ * Deletes all elements of the list in a single walk from the head, without
+ * relinking the Nodes that are left or moving out the data of each Node.
  */
 template<class T>
 void LinkedList<T>::clear()
 {
-    while(size != 0)
-        popFront();
+    Node<T>* current = head;
+    while(current != nullptr)
+    {
+        Node<T>* next = current->next;
+        freeNode(current);
+        current = next;
+    }
+
+    size = 0;
+    head = nullptr;
+    tail = nullptr;
 }
 
 /**
@@ -676,6 +841,35 @@ void LinkedList<T>::setTail(Node<T>* value)
     tail = value;
 }
 
+/**
+ * getPool()
+ *
+ * Returns a pointer to the pool that Nodes are allocated from, nullptr if
+ * Nodes are allocated on their own
+ */
+template<class T>
+NodePool<T>* LinkedList<T>::getPool() const
+{
+    return pool;
+}
+
+/**
+ * setPool()
+ *
+ * Sets the pool that Nodes are allocated from. Nodes already in the list
+ * would be freed to the wrong place, so the list must be empty.
+ *
+ * @param value : the pool to allocate Nodes from, or nullptr for none
+ * @exception logic_error if the list is not empty
+ */
+template<class T>
+void LinkedList<T>::setPool(NodePool<T>* value)
+{
+    if(size != 0)
+        throw std::logic_error("LinkedList<T>::setPool() - list is not empty");
+    pool = value;
+}
+
 /**
  * operator<<(std::ostream& o, const LinkedList& list)
  *
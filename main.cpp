@@ -1,6 +1,9 @@
 #define CATCH_CONFIG_RUNNER
 #include <catch.hpp>
 #include <output.h>
+#include <benchmark.h>
+#include <cstring>
+#include <cstdlib>
 using namespace std;
 
 int runCatchTests(int argc, char* const argv[])
@@ -13,7 +16,33 @@ int runCatchTests(int argc, char* const argv[])
 int main(int argc, char* argv[])
 {
 
-    if(argc != 5)
+    if(argc == 4 && strcmp(argv[1], "-snapshot") == 0)
+    {
+        //parse the schedule once, and save its graph for later runs
+        FlightData data(argv[2]);
+        FlightGraph graph(data);
+        if(!graph.save(argv[3]))
+            cerr << "Snapshot could not be written to " << argv[3] << endl;
+    }
+    else if(argc == 5 && strcmp(argv[1], "-stream") == 0)
+    {
+        //read, solve and write the requests as a pipeline
+        Output o(argv[2], argv[3], argv[4], SearchMode::K_SHORTEST, 3, 0, true);
+        o.print();
+    }
+    else if(argc == 6 && strcmp(argv[1], "-bench") == 0)
+    {
+        //measure the planner on a network of the given shape and size
+        Topology topology;
+        if(!Benchmark::parseTopology(argv[2], topology))
+            cerr << "Topology must be geometric, hubs or grid" << endl;
+        else
+        {
+            Benchmark bench(topology, atoi(argv[3]), atoi(argv[4]), atoi(argv[5]));
+            bench.run(cout);
+        }
+    }
+    else if(argc != 5)
         runCatchTests(argc, argv);
     else
     {
@@ -0,0 +1,145 @@
+#include "mappedfile.h"
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Constructor with const char*
+ *
+ * Maps the whole file read-only. The file descriptor is closed once the
+ * mapping is made, since the mapping keeps the file open by itself.
+ *
+ * @param fileName - the name of the file to map
+ * @exception invalid_argument if the file does not exist or cannot be mapped
+ */
+MappedFile::MappedFile(const char* fileName) : data{nullptr}, end{nullptr},
+    pos{nullptr}
+{
+    int fd = open(fileName, O_RDONLY);
+    if(fd == -1)
+        throw std::invalid_argument("File is not open or cannot be found.");
+
+    struct stat info;
+    if(fstat(fd, &info) == -1)
+    {
+        close(fd);
+        throw std::invalid_argument("File is not open or cannot be found.");
+    }
+
+    //an empty file cannot be mapped, and has no fields to read
+    if(info.st_size > 0)
+    {
+        void* map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(map == MAP_FAILED)
+        {
+            close(fd);
+            throw std::invalid_argument("File cannot be mapped into memory.");
+        }
+        madvise(map, info.st_size, MADV_SEQUENTIAL);
+
+        data = static_cast<const char*>(map);
+        end = data + info.st_size;
+        pos = data;
+    }
+    close(fd);
+}
+
+/**
+ * Destructor
+ */
+MappedFile::~MappedFile()
+{
+    if(data != nullptr)
+        munmap(const_cast<char*>(data), end - data);
+}
+
+/**
+ * nextField(delim)
+ *
+ * Returns the characters from the current position up to the delimiter, or
+ * up to the end of the file if there is no delimiter, and moves past the
+ * delimiter. A carriage return before a newline delimiter is dropped, so
+ * files with Windows line endings read the same.
+ *
+ * @param delim - the character the field ends at
+ * @return a view of the field within the mapping
+ */
+std::string_view MappedFile::nextField(char delim)
+{
+    if(pos == end)
+        return std::string_view{};
+
+    const char* start = pos;
+    const char* stop = static_cast<const char*>(memchr(pos, delim, end - pos));
+    if(stop == nullptr)
+    {
+        stop = end;
+        pos = end;
+    }
+    else
+    {
+        pos = stop + 1;
+    }
+
+    if(delim == '\n' && stop != start && *(stop - 1) == '\r')
+        stop--;
+
+    return std::string_view(start, stop - start);
+}
+
+/**
+ * nextInt(delim)
+ *
+ * Like atoi(), leading whitespace is skipped and a field that does not
+ * start with a number reads as 0.
+ *
+ * @param delim - the character the field ends at
+ * @return the number at the start of the next field
+ */
+int MappedFile::nextInt(char delim)
+{
+    std::string_view field{nextField(delim)};
+    const char* first = field.data();
+    const char* last = first + field.size();
+    while(first != last && (*first == ' ' || *first == '\t'))
+        first++;
+
+    int value{};
+    std::from_chars(first, last, value);
+    return value;
+}
+
+/**
+ * nextDouble(delim)
+ *
+ * Like atof(), leading whitespace is skipped and a field that does not
+ * start with a number reads as 0.
+ *
+ * @param delim - the character the field ends at
+ * @return the number at the start of the next field
+ */
+double MappedFile::nextDouble(char delim)
+{
+    std::string_view field{nextField(delim)};
+    const char* first = field.data();
+    const char* last = first + field.size();
+    while(first != last && (*first == ' ' || *first == '\t'))
+        first++;
+
+    double value{};
+    std::from_chars(first, last, value);
+    return value;
+}
+
+/**
+ * atEnd()
+ * @return true if there are no more characters to read, false otherwise
+ */
+bool MappedFile::atEnd() const
+{
+    return pos == end;
+}
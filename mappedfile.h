@@ -0,0 +1,47 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string_view>
+
+/**
+ * The MappedFile class maps a data file into memory and reads it as a
+ * sequence of delimited fields. Each field is handed out as a string_view
+ * into the mapping, so reading a field neither copies nor allocates, and
+ * numbers are parsed in place with std::from_chars.
+ *
+ * The file stays mapped until the MappedFile is destroyed, so the views it
+ * returns must not outlive it.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class MappedFile
+{
+    private:
+        const char* data;           //start of the mapping
+        const char* end;            //one past the last character
+        const char* pos;            //start of the next field
+
+    public:
+
+        //Constructors and destructor
+        MappedFile(const char* fileName);
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+        ~MappedFile();
+
+        //Returns the characters up to the delimiter, and skips past it
+        std::string_view nextField(char delim = '\n');
+
+        //Reads the next field as a number
+        int nextInt(char delim = '\n');
+        double nextDouble(char delim = '\n');
+
+        //Returns true once every field has been read
+        bool atEnd() const;
+};
+
+#endif // MAPPEDFILE_H
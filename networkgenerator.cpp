@@ -0,0 +1,302 @@
+#include "networkgenerator.h"
+#include <cmath>
+#include <outputwriter.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/**
+ * Constructor with Topology, int, int, unsigned int
+ *
+ * The number of legs is capped at the number of pairs of cities. Each leg
+ * is priced from its length, with some noise, so the cheapest and the
+ * quickest routes are not always the same.
+ *
+ * @param topology - the shape of the network
+ * @param numCities - the number of cities, at least 2
+ * @param numLegs - the number of legs, each flown both ways
+ * @param seed - the seed of the random numbers the network is made from
+ */
+NetworkGenerator::NetworkGenerator(Topology topology, int numCities,
+                                   int numLegs, unsigned int seed) :
+    topology{topology}, numCities{numCities < 2 ? 2 : numCities}, from{},
+    to{}, costs{}, durations{}, x{}, y{}, random{seed}
+{
+    long long pairs{static_cast<long long>(this->numCities) * (this->numCities - 1) / 2};
+    if(numLegs > pairs)
+        numLegs = static_cast<int>(pairs);
+    if(numLegs < 0)
+        numLegs = 0;
+
+    from.reserve(numLegs);
+    to.reserve(numLegs);
+    costs.reserve(numLegs);
+    durations.reserve(numLegs);
+
+    //every city is placed, so the price of a leg can follow its length
+    std::uniform_real_distribution<double> place(0, 1);
+    x.resize(this->numCities, 0);
+    y.resize(this->numCities, 0);
+    int side{static_cast<int>(std::ceil(std::sqrt(this->numCities)))};
+    for(int i{}; i < this->numCities; i++)
+    {
+        if(topology == Topology::GRID)
+        {
+            x[i] = (i % side) / static_cast<double>(side);
+            y[i] = (i / side) / static_cast<double>(side);
+        }
+        else
+        {
+            x[i] = place(random);
+            y[i] = place(random);
+        }
+    }
+
+    std::unordered_set<long long> joined{};
+    joined.reserve(numLegs);
+    if(topology == Topology::GEOMETRIC)
+        makeGeometric(numLegs, joined);
+    else if(topology == Topology::HUB_AND_SPOKE)
+        makeHubAndSpoke(numLegs, joined);
+    else
+        makeGrid(numLegs, joined);
+
+    //legs that the shape could not place are joined at random
+    std::uniform_int_distribution<int> city(0, this->numCities - 1);
+    while(from.length() < numLegs)
+        addLeg(city(random), city(random), joined);
+}
+
+/**
+ * pairKey(a, b)
+ * @return a number that is the same for a and b either way round
+ */
+static long long pairKey(int a, int b)
+{
+    if(a > b)
+        std::swap(a, b);
+    return static_cast<long long>(a) << 32 | b;
+}
+
+/**
+ * addLeg(a, b, joined)
+ *
+ * @param a - one city of the leg
+ * @param b - the other city of the leg
+ * @param joined - the pairs of cities already joined
+ * @return true if the leg was added, false if it joins a city to itself or
+ *         the cities were already joined
+ */
+bool NetworkGenerator::addLeg(int a, int b, std::unordered_set<long long>& joined)
+{
+    if(a == b || !joined.insert(pairKey(a, b)).second)
+        return false;
+
+    double length{std::hypot(x[a] - x[b], y[a] - y[b])};
+    std::uniform_real_distribution<double> noise(0.8, 1.25);
+    double cost{std::round((40 + 600 * length) * noise(random) * 100) / 100};
+    int duration{static_cast<int>(30 + 400 * length * noise(random))};
+
+    from.pushBack(a);
+    to.pushBack(b);
+    costs.pushBack(cost);
+    durations.pushBack(duration);
+    return true;
+}
+
+/**
+ * makeGeometric(numLegs, joined)
+ *
+ * Each leg starts at a random city and goes to the nearest of eight random
+ * cities it is not yet joined to.
+ *
+ * @param numLegs - the number of legs to add
+ * @param joined - the pairs of cities already joined
+ */
+void NetworkGenerator::makeGeometric(int numLegs, std::unordered_set<long long>& joined)
+{
+    std::uniform_int_distribution<int> city(0, numCities - 1);
+    for(int tries{}; from.length() < numLegs && tries < 4 * numLegs; tries++)
+    {
+        int a{city(random)};
+        int best{-1};
+        double bestLength{0};
+        for(int c{}; c < 8; c++)
+        {
+            int b{city(random)};
+            if(b == a || joined.count(pairKey(a, b)) != 0)
+                continue;
+            double length{std::hypot(x[a] - x[b], y[a] - y[b])};
+            if(best == -1 || length < bestLength)
+            {
+                best = b;
+                bestLength = length;
+            }
+        }
+        if(best != -1)
+            addLeg(a, best, joined);
+    }
+}
+
+/**
+ * makeHubAndSpoke(numLegs, joined)
+ *
+ * Every city after the first is joined to one city already in the network,
+ * so the network is connected if there are enough legs. Each end is picked
+ * from the list of the ends of every leg so far, so a city is picked in
+ * proportion to its number of legs.
+ *
+ * @param numLegs - the number of legs to add
+ * @param joined - the pairs of cities already joined
+ */
+void NetworkGenerator::makeHubAndSpoke(int numLegs, std::unordered_set<long long>& joined)
+{
+    Vector<int> ends{};
+    ends.pushBack(0);
+    for(int i{1}; i < numCities && from.length() < numLegs; i++)
+    {
+        std::uniform_int_distribution<int> end(0, ends.length() - 1);
+        int hub{ends[end(random)]};
+        addLeg(i, hub, joined);
+        ends.pushBack(i);
+        ends.pushBack(hub);
+    }
+
+    std::uniform_int_distribution<int> city(0, numCities - 1);
+    for(int tries{}; from.length() < numLegs && tries < 4 * numLegs; tries++)
+    {
+        std::uniform_int_distribution<int> end(0, ends.length() - 1);
+        int a{city(random)};
+        int hub{ends[end(random)]};
+        if(addLeg(a, hub, joined))
+        {
+            ends.pushBack(a);
+            ends.pushBack(hub);
+        }
+    }
+}
+
+/**
+ * makeGrid(numLegs, joined)
+ *
+ * Rows are joined before columns, a row at a time, so a grid with fewer
+ * legs than it has edges is still joined along its rows.
+ *
+ * @param numLegs - the number of legs to add
+ * @param joined - the pairs of cities already joined
+ */
+void NetworkGenerator::makeGrid(int numLegs, std::unordered_set<long long>& joined)
+{
+    int side{static_cast<int>(std::ceil(std::sqrt(numCities)))};
+    for(int i{}; i < numCities && from.length() < numLegs; i++)
+    {
+        if((i + 1) % side != 0 && i + 1 < numCities)
+            addLeg(i, i + 1, joined);
+    }
+    for(int i{}; i + side < numCities && from.length() < numLegs; i++)
+        addLeg(i, i + side, joined);
+}
+
+/**
+ * writeSchedule(fileName)
+ *
+ * Example line: City 12|City 40|215.37|118
+ *
+ * @param fileName - the name of the file to write
+ * @return true if the schedule was written, false if not
+ */
+bool NetworkGenerator::writeSchedule(const char* fileName) const
+{
+    try
+    {
+        OutputWriter file(fileName);
+        file << from.length() << '\n';
+        for(int i{}; i < from.length(); i++)
+        {
+            file << cityName(from[i]).c_str() << '|' << cityName(to[i]).c_str() << '|';
+            file.writeFixed(costs[i], 2);
+            file << '|' << durations[i] << '\n';
+        }
+        file.close();
+    }
+    catch(const std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * writeRequests(fileName, numRequests, seed)
+ *
+ * Example line: City 3|City 17|T
+ *
+ * @param fileName - the name of the file to write
+ * @param numRequests - the number of requests to write
+ * @param seed - the seed the cities and metrics are picked with
+ * @return true if the requests were written, false if not
+ */
+bool NetworkGenerator::writeRequests(const char* fileName, int numRequests,
+                                     unsigned int seed) const
+{
+    std::mt19937 picker(seed);
+    std::uniform_int_distribution<int> city(0, numCities - 1);
+    std::uniform_int_distribution<int> other(1, numCities - 1);
+    std::bernoulli_distribution byTime(0.5);
+
+    try
+    {
+        OutputWriter file(fileName);
+        file << numRequests << '\n';
+        for(int i{}; i < numRequests; i++)
+        {
+            int origin{city(picker)};
+            int destination{(origin + other(picker)) % numCities};
+            file << cityName(origin).c_str() << '|' << cityName(destination).c_str()
+                 << '|' << (byTime(picker) ? 'T' : 'C') << '\n';
+        }
+        file.close();
+    }
+    catch(const std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * cityName(city)
+ * @param city - the number of a city
+ * @return the name of the city, such as "City 12"
+ */
+std::string NetworkGenerator::cityName(int city)
+{
+    return "City " + std::to_string(city);
+}
+
+/**
+ * getNumCities()
+ * @return the number of cities within the network
+ */
+int NetworkGenerator::getNumCities() const
+{
+    return numCities;
+}
+
+/**
+ * getNumLegs()
+ * @return the number of legs within the network, each flown both ways
+ */
+int NetworkGenerator::getNumLegs() const
+{
+    return from.length();
+}
+
+/**
+ * getTopology()
+ * @return the shape of the network
+ */
+Topology NetworkGenerator::getTopology() const
+{
+    return topology;
+}
@@ -0,0 +1,87 @@
+#ifndef NETWORKGENERATOR_H
+#define NETWORKGENERATOR_H
+
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector.h>
+
+/**
+ * The shape of a synthetic flight network.
+ *
+ * GEOMETRIC      - cities are scattered over a square, and each leg joins
+ *                  a city to one of the nearest of a few random others,
+ *                  so most flights are short and regional
+ * HUB_AND_SPOKE  - each new leg picks one end with a chance in proportion
+ *                  to how many legs the city has already, so a few hubs
+ *                  gather most of the flights (a scale-free network)
+ * GRID           - cities sit on a square grid joined to their neighbours,
+ *                  which gives long routes with many ties
+ */
+enum class Topology
+{
+    GEOMETRIC,
+    HUB_AND_SPOKE,
+    GRID
+};
+
+/**
+ * The NetworkGenerator class makes random flight schedules, and requests
+ * between their cities, to measure the planner on networks of any size.
+ * Schedules are written in the pipe format read by FlightData, with every
+ * pair of cities joined at most once, and requests in the format read by
+ * FlightRequests.
+ *
+ * The network is made when the generator is constructed, from the seed
+ * given, so the same arguments always give the same files.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class NetworkGenerator
+{
+    private:
+        Topology topology;
+        int numCities;
+        Vector<int> from;               //first city of each leg
+        Vector<int> to;                 //second city of each leg
+        Vector<double> costs;           //cost of each leg, in dollars
+        Vector<int> durations;          //duration of each leg, in minutes
+        Vector<double> x, y;            //position of each city
+        std::mt19937 random;
+
+        //Adds a leg between two cities unless they are already joined, with
+        //each pair of cities kept as one number within joined
+        bool addLeg(int a, int b, std::unordered_set<long long>& joined);
+
+        //Makes the legs of each topology
+        void makeGeometric(int numLegs, std::unordered_set<long long>& joined);
+        void makeHubAndSpoke(int numLegs, std::unordered_set<long long>& joined);
+        void makeGrid(int numLegs, std::unordered_set<long long>& joined);
+
+    public:
+
+        //Constructors
+        NetworkGenerator(Topology topology, int numCities, int numLegs,
+                         unsigned int seed = 2341);
+
+        //Writes the schedule, returning false if it cannot be written
+        bool writeSchedule(const char* fileName) const;
+
+        //Writes requests between random cities, half of them by time
+        bool writeRequests(const char* fileName, int numRequests,
+                           unsigned int seed = 2341) const;
+
+        //Returns the name of a city, as written to the files
+        static std::string cityName(int city);
+
+        //Size of the network
+        int getNumCities() const;
+        int getNumLegs() const;
+        Topology getTopology() const;
+};
+
+#endif // NETWORKGENERATOR_H
@@ -1,5 +1,6 @@
 #pragma once
 #include <ostream>
+#include <utility>
 
 
 /**
@@ -26,12 +27,16 @@ class Node
     public:
         //Constructors
         Node();
-        Node(T data);
+        Node(const T& data);
+        Node(T&& data);
+        template<class... Args>
+        Node(std::in_place_t, Args&&... args);
         Node(const Node<T>& n);
         Node<T>& operator=(const Node<T>& n);
 
         //Getters and setters
         T getData() const;
+        T& getData();
         void setData(const T& value);
         Node<T>* getNext() const;
         void setNext(Node<T>* value);
@@ -50,14 +55,35 @@ template<class T>
 Node<T>::Node() : next{nullptr}, previous{nullptr}, data{} {}
 
 /**
- * Constructor with (T data) - will usually be the most-used constructor,
- * and creates a Node with nullptr references to other nodes, but contains
- * the data given by the user.
+ * Constructor with (const T& data) - will usually be the most-used
+ * constructor, and creates a Node with nullptr references to other nodes,
+ * but contains a copy of the data given by the user.
  *
  * @param data : data passed by the user
  */
 template<class T>
-Node<T>::Node(T data) : data{data}, next{nullptr}, previous{nullptr} {}
+Node<T>::Node(const T& data) : data{data}, next{nullptr}, previous{nullptr} {}
+
+/**
+ * Constructor with (T&& data) - moves the data given by the user into the
+ * Node instead of copying it.
+ *
+ * @param data : data passed by the user, which is moved from
+ */
+template<class T>
+Node<T>::Node(T&& data) : data{std::move(data)}, next{nullptr},
+    previous{nullptr} {}
+
+/**
+ * Constructor with (std::in_place, args...) - constructs the data within
+ * the Node from the arguments, so it is neither copied nor moved.
+ *
+ * @param args : the arguments to pass to the constructor of the data
+ */
+template<class T>
+template<class... Args>
+Node<T>::Node(std::in_place_t, Args&&... args)
+    : data(std::forward<Args>(args)...), next{nullptr}, previous{nullptr} {}
 
 /**
  * Copy constructor
@@ -75,6 +101,7 @@ Node<T>& Node<T>::operator=(const Node<T>& n)
     data = n.data;
     next = n.next;
     previous = n.previous;
+    return *this;
 }
 
 /**
@@ -88,6 +115,18 @@ T Node<T>::getData() const
     return data;
 }
 
+/**
+ * getData()
+ *
+ * @return a reference to the data within the Node, so lists can be
+ *         traversed through their Nodes without copying each element
+ */
+template<class T>
+T& Node<T>::getData()
+{
+    return data;
+}
+
 /**
  * setData(value)
  *
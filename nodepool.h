@@ -0,0 +1,181 @@
+#ifndef NODEPOOL
+#define NODEPOOL
+
+#include <node.h>
+#include <new>
+#include <utility>
+
+/**
+ * A NodePool allocates the Nodes of one or more LinkedLists from slabs of
+ * fixed-size slots, rather than allocating each Node on its own. Released
+ * Nodes are kept on a free list and handed out again, so a list that grows
+ * and shrinks repeatedly stops calling the allocator once the pool holds
+ * enough slots, and Nodes allocated together sit next to each other in
+ * memory.
+ *
+ * Slabs are only freed when the pool is destroyed, so the pool must outlive
+ * every list that uses it. A NodePool is not thread-safe: the lists that
+ * share a pool must only add or remove Nodes from one thread at a time.
+ *
+ * The NodePool class will be used by the LinkedList class in the Sprint4:
+ * Flight Planner project in SMU CSE2341.
+ *
+ * By: Oisin Coveney
+ * Created:         October 17, 2026
+ * Last Modified:   October 17, 2026
+ */
+template<class T>
+class NodePool
+{
+    private:
+
+        //A slot holds either a Node, or the link to the next free slot
+        union Slot
+        {
+            Slot* next;
+            alignas(Node<T>) unsigned char storage[sizeof(Node<T>)];
+        };
+
+        //A slab is an array of slots, linked to the slab allocated before it
+        struct Slab
+        {
+            Slab* next;
+            Slot* slots;
+        };
+
+        Slab* slabs;            //every slab allocated by the pool
+        Slot* freeSlots;        //slots that do not hold a Node
+        int slabSize;           //number of slots within each slab
+        int numNodes;           //number of Nodes handed out
+
+        //Allocates a new slab and adds its slots to the free list
+        void grow();
+
+    public:
+
+        //Constructors and destructor
+        NodePool(int slabSize = 256);
+        NodePool(const NodePool& other) = delete;
+        NodePool& operator=(const NodePool& other) = delete;
+        ~NodePool();
+
+        //Constructs a Node within a free slot
+        template<class... Args>
+        Node<T>* create(Args&&... args);
+
+        //Destroys a Node and returns its slot to the free list
+        void destroy(Node<T>* node);
+
+        //Returns the number of Nodes that have not been destroyed
+        int size() const;
+};
+
+
+/**
+ * Constructor with int
+ *
+ * No slab is allocated until the first Node is created.
+ *
+ * @param slabSize : the number of Nodes allocated at a time
+ */
+template<class T>
+NodePool<T>::NodePool(int slabSize) : slabs{nullptr}, freeSlots{nullptr},
+    slabSize{(slabSize > 0) ? slabSize : 1}, numNodes{0} {}
+
+/**
+ * Destructor
+ *
+ * Frees every slab. Any Node that has not been destroyed is freed without
+ * its data being destroyed.
+ */
+template<class T>
+NodePool<T>::~NodePool()
+{
+    while(slabs != nullptr)
+    {
+        Slab* next = slabs->next;
+        delete[] slabs->slots;
+        delete slabs;
+        slabs = next;
+    }
+}
+
+/**
+ * grow()
+ *
+ * Allocates a slab, and links its slots onto the free list in order, so
+ * Nodes created one after another are next to each other in memory.
+ */
+template<class T>
+void NodePool<T>::grow()
+{
+    Slab* slab = new Slab{slabs, new Slot[slabSize]};
+    slabs = slab;
+
+    for(int i{}; i < slabSize - 1; i++)
+        slab->slots[i].next = &slab->slots[i + 1];
+    slab->slots[slabSize - 1].next = freeSlots;
+    freeSlots = slab->slots;
+}
+
+/**
+ * create(args...)
+ *
+ * @param args : the arguments to pass to the constructor of the Node
+ * @return a pointer to the new Node
+ */
+template<class T>
+template<class... Args>
+Node<T>* NodePool<T>::create(Args&&... args)
+{
+    if(freeSlots == nullptr)
+        grow();
+
+    //unlink the slot first, since the Node is constructed over the link
+    Slot* slot = freeSlots;
+    freeSlots = slot->next;
+
+    Node<T>* node;
+    try
+    {
+        node = new (slot->storage) Node<T>(std::forward<Args>(args)...);
+    }
+    catch(...)
+    {
+        slot->next = freeSlots;
+        freeSlots = slot;
+        throw;
+    }
+    numNodes++;
+    return node;
+}
+
+/**
+ * destroy(node)
+ *
+ * @param node : a Node created by this pool, which must not be used again
+ */
+template<class T>
+void NodePool<T>::destroy(Node<T>* node)
+{
+    node->~Node<T>();
+
+    Slot* slot = reinterpret_cast<Slot*>(node);
+    slot->next = freeSlots;
+    freeSlots = slot;
+    numNodes--;
+}
+
+/**
+ * size()
+ *
+ * @return the number of Nodes created by the pool that have not been
+ *         destroyed
+ */
+template<class T>
+int NodePool<T>::size() const
+{
+    return numNodes;
+}
+
+#endif
@@ -12,26 +12,144 @@ Output::Output()
 }
 
 /**
- * Constructor with char*, char*, char*
- * @param dataFile - the flight data input file
+ * Constructor with char*, char*, char*, SearchMode, int, int, bool,
+ * WriteMode, const char*
+ * @param dataFile - the flight data input file, or a snapshot of the graph
+ *                   saved by FlightGraph::save()
  * @param requestFile - input file for requested flight plans
  * @param outputFile - the output file to put the final output in
+ * @param mode - the search used to find flights, which defaults to K_SHORTEST
+ * @param numPaths - the number of paths printed for each request, which
+ *                   defaults to 3
+ * @param numThreads - the number of threads to solve requests on, which
+ *                     defaults to one for each core
+ * @param streaming - true to read, solve and write the requests as a
+ *                    pipeline within print(), which defaults to false
+ * @param writeMode - how the output file is written, which defaults to
+ *                    BUFFERED
+ * @param landmarkFile - the file the landmark tables of ASTAR mode are kept
+ *                       in between runs, which defaults to none
+ *
+ * A snapshot is mapped into memory instead of being parsed, and the
+ * requests are given the ids of the cities within the graph either way.
+ * In ASTAR mode, the landmark tables are built for each run, unless a
+ * landmark file is given: then they are loaded from it, or built and saved
+ * there if the file is missing or was made for a different schedule.
+ * Nothing is written beside the data file otherwise. In HIERARCHY mode,
+ * a contraction hierarchy is built for each metric that a request uses,
+ * both at once when there is more than one thread. In ALL_PAIRS mode, the
+ * tables of every route are built the same way, each across every thread.
+ *
+ * @exception invalid_argument if a file cannot be found, or the snapshot is
+ *              damaged or was saved by another version
  */
-Output::Output(char* dataFile, char* requestFile, char* outputFile)
-    : data{dataFile}, requests{requestFile}, plans{}
+Output::Output(char* dataFile, char* requestFile, char* outputFile,
+               SearchMode mode, int numPaths, int numThreads, bool streaming,
+               WriteMode writeMode, const char* landmarkFile)
+    : snapshot{FlightGraph::isSnapshot(dataFile)},
+      data{snapshot ? FlightData() : FlightData(dataFile)},
+      requests{}, graph{data},
+      landmarks{}, costHierarchy{}, timeHierarchy{}, costTable{}, timeTable{},
+      plans{}, cache{}, mode{mode},
+      numPaths{numPaths},
+      numThreads{numThreads}, streaming{streaming}
 {
-    o.open(outputFile);
-    retrieveFlights();
+    //a snapshot of the graph is mapped in place of parsing the schedule
+    if(snapshot && !graph.load(dataFile))
+        throw std::invalid_argument("Snapshot is damaged or of another version.");
+
+    //when streaming, requests are read as they are solved, so either metric
+    //may be asked for
+    if(streaming)
+    {
+        requestStream.open(requestFile);
+        if(!requestStream.is_open())
+            throw std::invalid_argument("File is not open or cannot be found.");
+    }
+    else
+        requests = FlightRequests(requestFile, graph.getCities());
+
+    //the metrics the requests are weighed by
+    const Vector<Request>& reqs{requests.getRequests()};
+    bool needCost{streaming}, needTime{streaming};
+    for(int i{}; i < reqs.length(); i++)
+    {
+        if(reqs[i].getTimeTag())
+            needTime = true;
+        else
+            needCost = true;
+    }
+
+    if(mode == SearchMode::ASTAR)
+    {
+        if(landmarkFile == nullptr || !landmarks.load(landmarkFile, graph))
+        {
+            landmarks.build(graph);
+            if(landmarkFile != nullptr)
+                landmarks.save(landmarkFile, graph);
+        }
+    }
+    else if(mode == SearchMode::ALL_PAIRS)
+    {
+        ThreadPool pool(this->numThreads);
+        if(needCost)
+            costTable.build(graph, false, pool);
+        if(needTime)
+            timeTable.build(graph, true, pool);
+    }
+    else if(mode == SearchMode::HIERARCHY)
+    {
+        //the two hierarchies share nothing but the graph, so with more than
+        //one thread they are built at once
+        if(needCost && needTime && this->numThreads != 1)
+        {
+            std::thread costBuilder([this]() { costHierarchy.build(graph, false); });
+            timeHierarchy.build(graph, true);
+            costBuilder.join();
+        }
+        else
+        {
+            if(needCost)
+                costHierarchy.build(graph, false);
+            if(needTime)
+                timeHierarchy.build(graph, true);
+        }
+    }
+
+    o.open(outputFile, writeMode);
+    if(!streaming)
+        retrieveFlights();
 }
 
 /**
  * retrieveFlights()
  *
- * Iterates through the requests in the FlightRequests object and calls
- * the backTrack() function, which finds all possible combinations of
- * flights for each request. These flights are found with the FlightData
- * object, whose linked list of Origin objects provides the information
- * needed to find all possible flights.
+ * Iterates through the requests in the FlightRequests object and finds
+ * the flights for each request with the search given by the mode.
+ *
+ * In K_SHORTEST mode, the PathFinder returns only the plans that will be
+ * printed for each request, and in DIJKSTRA mode it returns the single best
+ * plan for each request. BIDIRECTIONAL mode also returns the single best
+ * plan, found by searching from the origin and destination at once, as
+ * does ASTAR mode with a search guided by landmark lower bounds,
+ * HIERARCHY mode with a search through contraction hierarchies, and
+ * ALL_PAIRS mode by following the tables of every route. In
+ * BACKTRACK mode, the backTrack() function finds all possible
+ * combinations of flights for each request. These flights are found by
+ * walking the FlightGraph from the origin.
+ *
+ * The requests are spread across the threads of a ThreadPool. The graph
+ * and schedule are only read during the searches, and each thread has its
+ * own PathFinder or PathStack, so requests do not share any state that is
+ * written to.
+ * Each result is stored at the index of its request within the plans
+ * vector, so the plans are kept in request order.
+ *
+ * The plans found for each request are also kept in a PlanCache, so a
+ * request between the same cities by the same metric is copied instead of
+ * searched for again. Every journey is found by BACKTRACK whichever metric
+ * they are sorted by, so in that mode the journeys are cached before they
+ * are sorted, and a request by either metric is sorted from the cache.
  *
  * After the flights are retrieved, each FlightPlan within the plans
  * LinkedList is sorted by the user's request in finding either the
@@ -40,121 +158,560 @@ Output::Output(char* dataFile, char* requestFile, char* outputFile)
  */
 void Output::retrieveFlights()
 {
-    LinkedList<Origin> flightdata{data.getFlights()};
-    LinkedList<Request> reqs{requests.getRequests()};
+    const Vector<Request>& reqs{requests.getRequests()};
+    int numReqs = reqs.length();
+    plans.clear();
+    plans.resize(numReqs, FlightPlans());
 
-    //Get flights via backTrack()
-    for(int i{}; i < reqs.length(); i++)
+    //Requests that share a search are solved together, in request order
+    Vector<Vector<int>> groups{groupRequests()};
+
+    //Each worker has its own search state
+    ThreadPool pool(numThreads);
+    PathFinder** finders = new PathFinder*[pool.size()];
+    PathStack** paths = new PathStack*[pool.size()];
+    for(int i{}; i < pool.size(); i++)
     {
-        plans.pushBack(backTrack(flightdata, reqs[i]));
+        bool backtracking{mode == SearchMode::BACKTRACK};
+        finders[i] = backtracking ? nullptr : new PathFinder(graph);
+        paths[i] = backtracking ? new PathStack(graph) : nullptr;
     }
+
+    pool.run(groups.length(), [&](int worker, int g)
+    {
+        if(mode == SearchMode::BACKTRACK)
+            solveFromOrigin(groups[g], *paths[worker]);
+        else
+        {
+            for(int i : groups[g])
+                plans[i] = solveRequest(reqs[i], finders[worker], nullptr);
+        }
+    });
+
+    for(int i{}; i < pool.size(); i++)
+    {
+        delete finders[i];
+        delete paths[i];
+    }
+    delete[] finders;
+    delete[] paths;
 }
 
 /**
- * backTrack(LinkedList<Origin>, Request)
+ * groupRequests()
  *
- * Takes in a linked list of the flight data and a user request,
- * and uses iterative backtracking to find all flights that match
- * the user's request for a journey between the origin and destination.
+ * In BACKTRACK mode, requests are grouped by their origin, since one walk
+ * from the origin finds the journeys to every destination. In DIJKSTRA
+ * mode, they are grouped by their destination and metric, since the
+ * PathFinder searches outward from the destination and keeps the distances
+ * it found for the next request. In every other mode, each request is a
+ * group of its own. Requests between cities that are not within the
+ * schedule have no plans, and are left out of every group.
  *
- * @param schedule - a LinkedList containing Origin objects that contain all
- *                   data about each journey
- * @param r - a user Request specifying the origin, destination, and whether
- *            flights should be sorted by
- * @return
+ * @return the indices of the requests of each group, in request order
  */
-FlightPlans Output::backTrack(LinkedList<Origin> schedule, Request r)
+Vector<Vector<int>> Output::groupRequests()
 {
-    Stack<Origin> stack{};
+    const Vector<Request>& reqs{requests.getRequests()};
+    Vector<Vector<int>> groups{};
+    Vector<int> groupOf{};              //group of each city and metric
+    groupOf.resize(2 * graph.getNumCities(), -1);
 
-    for(int i{}; i < schedule.length(); i++)
+    for(int i{}; i < reqs.length(); i++)
     {
-        if(schedule[i] == r.getOrigin())
+        int origin{}, target{};
+        findCities(reqs[i], origin, target);
+        if(origin == -1 || target == -1)
         {
-            stack.push(schedule[i]);
-            break;
+            plans[i] = FlightPlans(Vector<Plan>{}, reqs[i]);
+            continue;
         }
+
+        int shared{-1};
+        if(mode == SearchMode::BACKTRACK)
+            shared = 2 * origin;
+        else if(mode == SearchMode::DIJKSTRA)
+            shared = 2 * target + (reqs[i].getTimeTag() ? 1 : 0);
+
+        if(shared == -1 || groupOf[shared] == -1)
+        {
+            if(shared != -1)
+                groupOf[shared] = groups.length();
+            groups.pushBack(Vector<int>{});
+            groups.back().pushBack(i);
+        }
+        else
+            groups[groupOf[shared]].pushBack(i);
     }
+    return groups;
+}
 
-    Origin* current = nullptr;
-    LinkedList<Plan> flightlist{};
-    String destination{r.getDestination()};
+/**
+ * solveRequest(r, finder, path)
+ *
+ * Finds the plans of a request with the search given by the mode, or
+ * copies them from the cache if the request was already solved. In
+ * BACKTRACK mode, the journeys are cached before they are sorted, so a
+ * request by either metric is sorted from the cache.
+ *
+ * @param r - the request to solve
+ * @param finder - the search state of the worker, used in every mode but
+ *                 BACKTRACK
+ * @param path - the path of the worker, used in BACKTRACK mode
+ * @return the plans of the request
+ */
+FlightPlans Output::solveRequest(const Request& r, PathFinder* finder,
+                                 PathStack* path)
+{
+    int origin{}, target{};
+    findCities(r, origin, target);
+    if(origin == -1 || target == -1)
+        return FlightPlans(Vector<Plan>{}, r);
+
+    //Repeated requests are copied from the cache
+    long long key{cacheKey(r)};
+    Vector<Plan> cached{};
+    if(cache.find(key, cached))
+        return FlightPlans(std::move(cached), r);
 
-    while(!stack.isEmpty())
+    FlightPlans found{};
+    if(mode == SearchMode::BACKTRACK)
+    {
+        //Get every journey via findJourneys()
+        Vector<Plan> journeys{journeysTo(origin, target, *path)};
+        cache.insert(key, journeys);
+        return FlightPlans(std::move(journeys), r);
+    }
+    else if(mode == SearchMode::DIJKSTRA)
+    {
+        //Get the best flight via the PathFinder
+        found = finder->bestPlan(r);
+    }
+    else if(mode == SearchMode::BIDIRECTIONAL)
+    {
+        //Get the best flight via a search from both ends
+        found = finder->bidirectionalPlan(r);
+    }
+    else if(mode == SearchMode::ASTAR)
     {
-        current = stack.peekPointer();
+        //Get the best flight via a search guided by the landmarks
+        found = finder->aStarPlan(r, landmarks);
+    }
+    else if(mode == SearchMode::HIERARCHY)
+    {
+        //Get the best flight via the hierarchy for its metric
+        found = finder->hierarchyPlan(r,
+            r.getTimeTag() ? timeHierarchy : costHierarchy);
+    }
+    else if(mode == SearchMode::ALL_PAIRS)
+    {
+        //Get the best flight via the tables for its metric
+        found = finder->allPairsPlan(r,
+            r.getTimeTag() ? timeTable : costTable);
+    }
+    else
+    {
+        //Get the flights that will be printed via the PathFinder
+        found = finder->topPlans(r, numPaths);
+    }
 
-        if(inStack(current, stack))
-            stack.pop();
-        else
-        {
-            LinkedList<Destination>& dests{current->getDestinations()};
-            int s = dests.length();
-            for(int i{}; i < s; i++)
-            {
-                Destination& d{dests[i]};
+    cache.insert(key, found.getPlans());
+    return found;
+}
 
-                if(!d.getVisited())
-                {
-                    d.setVisited(true);
+/**
+ * solveFromOrigin(group, path)
+ *
+ * Finds every journey for a group of requests that share an origin. The
+ * journeys to destinations that are within the cache are copied from it,
+ * and the journeys to every other destination are found by a single walk
+ * from the origin. Journeys are cached before they are sorted, so each
+ * request (by either metric) is sorted from the same list.
+ *
+ * @param group - the indices of the requests, which all have the same origin
+ * @param path - the path of the walk, which is emptied and reused
+ */
+void Output::solveFromOrigin(const Vector<int>& group, PathStack& path)
+{
+    const Vector<Request>& reqs{requests.getRequests()};
+    int numCities = graph.getNumCities();
+    int origin{}, target{};
 
-                    current->setCost(d.getCost());
-                    current->setDuration(d.getDuration());
+    Vector<Vector<Plan>> lists{};       //journeys to each destination
+    Vector<int> listOf{};               //list of each destination, by city
+    listOf.resize(numCities, -1);
+    Vector<Vector<Plan>> journeys{};    //journeys found by the walk
+    Vector<int> found{};                //journeys of each destination walked to
+    found.resize(numCities, -1);
 
-                    if(d.getName() == destination)
-                        flightlist.pushBack(Plan(stack, destination));
-                    else
-                        stack.push(*(d.getOriginPtr()));
+    for(int i : group)
+    {
+        findCities(reqs[i], origin, target);
+        if(listOf[target] != -1)
+            continue;
 
-                    break;
-                }
-                else if(i == dests.length() - 1)
-                    stack.pop();
-            }
+        listOf[target] = lists.length();
+        Vector<Plan> cached{};
+        if(!cache.find(cacheKey(reqs[i]), cached))
+        {
+            found[target] = journeys.length();
+            journeys.pushBack(Vector<Plan>{});
         }
+        lists.pushBack(std::move(cached));
+    }
+
+    if(!journeys.empty())
+        findJourneys(origin, found, journeys, path);
+
+    for(int i : group)
+    {
+        findCities(reqs[i], origin, target);
+        if(found[target] != -1)
+        {
+            cache.insert(cacheKey(reqs[i]), journeys[found[target]]);
+            lists[listOf[target]] = std::move(journeys[found[target]]);
+            found[target] = -1;
+        }
+        plans[i] = FlightPlans(lists[listOf[target]], reqs[i]);
     }
-    return FlightPlans(flightlist, r);
 }
 
+/**
+ * cacheKey(r)
+ *
+ * @param r - a user Request
+ * @return the key of the request within the cache, which leaves out the
+ *         metric in BACKTRACK mode, or -1 if either city is not within
+ *         the schedule
+ */
+long long Output::cacheKey(const Request& r) const
+{
+    int origin{}, target{};
+    findCities(r, origin, target);
+    if(origin == -1 || target == -1)
+        return -1;
+    return PlanCache::makeKey(origin, target,
+                              mode != SearchMode::BACKTRACK && r.getTimeTag());
+}
 
-bool Output::inStack(Origin* o, Stack<Origin>& s)
+/**
+ * getCache()
+ * @return the cache of the plans found for each request
+ */
+const PlanCache& Output::getCache() const
 {
+    return cache;
+}
 
-    LinkedList<Origin> list{s.readStack()};
-    String oName = o->getName();
+/**
+ * backTrack(Request, PathStack&)
+ *
+ * Takes in a user request, and finds every journey between the origin and
+ * destination with findJourneys(), sorted by the user's request.
+ *
+ * @param r - a user Request specifying the origin, destination, and whether
+ *            flights should be sorted by
+ * @param path - the path of the search, which is emptied and reused
+ * @return the FlightPlans holding every journey for the request
+ */
+FlightPlans Output::backTrack(const Request& r, PathStack& path)
+{
+    int origin{}, target{};
+    findCities(r, origin, target);
+    if(origin == -1 || target == -1)
+        return FlightPlans(Vector<Plan>{}, r);
+    return FlightPlans(journeysTo(origin, target, path), r);
+}
 
+/**
+ * journeysTo(origin, target, path)
+ *
+ * @param origin - the id of the city the journeys leave from
+ * @param target - the id of the city the journeys arrive at
+ * @param path - the path of the search, which is emptied and reused
+ * @return every journey between the cities, in the order findJourneys()
+ *         finds them
+ */
+Vector<Plan> Output::journeysTo(int origin, int target, PathStack& path)
+{
+    Vector<int> found{};
+    found.resize(graph.getNumCities(), -1);
+    found[target] = 0;
+    Vector<Vector<Plan>> journeys{};
+    journeys.pushBack(Vector<Plan>{});
+
+    findJourneys(origin, found, journeys, path);
+    return std::move(journeys[0]);
+}
+
+/**
+ * findJourneys(origin, found, journeys, path)
+ *
+ * Uses iterative backtracking over the flight graph to find every journey
+ * from the origin to each of a set of destinations in one walk.
+ *
+ * The path holds only the id of each city on it, the next flight to try
+ * from it, and the totals of the flights taken so far. A Plan is only made
+ * from the path when one of its flights reaches a destination, so the
+ * schedule is never copied or written to. Flights back to a city already on
+ * the path are skipped, which the path checks in constant time, except
+ * that a flight back to the origin ends a round trip. With more than one
+ * destination, the walk goes on past each one to reach the others, and the
+ * journeys to each destination are found in the same order as a walk to
+ * that destination alone would find them.
+ *
+ * @param origin - the id of the city the journeys leave from
+ * @param found - the index within journeys of each destination, by city
+ *                id, or -1 for every other city
+ * @param journeys - the journeys to each destination, which are added to in
+ *                   the order they are found
+ * @param path - the path of the search, which is emptied and reused
+ */
+void Output::findJourneys(int origin, const Vector<int>& found,
+                          Vector<Vector<Plan>>& journeys, PathStack& path)
+{
+    //a walk to a single destination never needs to pass through it
+    bool passThrough{journeys.length() > 1};
 
-    for(int i{}; i < list.length()-1; i++)
+    path.start(origin);
+    while(!path.isEmpty())
     {
-        if(oName == list[i].getName())
-            return true;
+        int flight = path.nextFlight();
+        if(flight == -1)
+        {
+            path.pop();
+            continue;
+        }
+
+        int next = graph.getTarget(flight);
+        bool loops{path.contains(next)};
+        if(found[next] != -1 && (!loops || next == origin))
+            journeys[found[next]].pushBack(Plan(path, flight));
+
+        if(!loops && (found[next] == -1 || passThrough))
+            path.push(flight);
     }
-    return false;
 }
 
+/**
+ * findCities(r, origin, target)
+ *
+ * @param r - a user Request
+ * @param origin - set to the id of the origin of the request, or -1 if it
+ *                 is not within the schedule
+ * @param target - set to the id of the destination of the request, or -1
+ */
+void Output::findCities(const Request& r, int& origin, int& target) const
+{
+    origin = r.getOriginId();
+    target = r.getDestinationId();
+
+    //look up the cities of requests that were not given ids
+    if(origin == -1)
+        origin = graph.findCity(r.getOrigin());
+    if(target == -1)
+        target = graph.findCity(r.getDestination());
+}
+
+/**
+ * print()
+ *
+ * Writes the block of each request to the output file, in request order.
+ * When streaming, the requests are read and solved here as well. Blocks
+ * are gathered within the buffer of the OutputWriter, which is written
+ * out as it fills and once more at the end.
+ */
 void Output::print()
 {
-    for(int i{}; i < plans.length(); i++)
-    {
-        FlightPlans& f{plans[i]};
-        Request r = f.getRequest();
-        o << "Flight " << i+1 << ": ";
-        o << r.getOrigin() << ", " << r.getDestination();
-        o << " (";
-        if(r.getTimeTag())
-            o << "Time";
-        else
-            o << "Cost";
-        o << ")" << std::endl;
+    if(streaming)
+        streamFlights();
+    else
+    {
+        for(int i{}; i < plans.length(); i++)
+            printPlans(i + 1, plans[i]);
+    }
+    o.flush();
+}
+
+/**
+ * printPlans(number, f)
+ *
+ * Writes the block of a single request to the output file.
+ *
+ * @param number - the number the request is printed with, from 1
+ * @param f - the plans of the request
+ */
+void Output::printPlans(int number, const FlightPlans& f)
+{
+    Request r = f.getRequest();
+    o << "Flight " << number << ": ";
+    o << r.getOrigin() << ", " << r.getDestination();
+    o << " (";
+    if(r.getTimeTag())
+        o << "Time";
+    else
+        o << "Cost";
+    o << ")\n";
+
+    const Vector<Plan>& p{f.getPlans()};
+
+    for(int j{}; j < numPaths && j < p.length(); j++)
+    {
+        o << "Path " << j+1 << ": ";
+        o << p[j];
+    }
+    o << "\n\n";
+}
+
+/**
+ * streamFlights()
+ *
+ * Reads, solves and writes the requests as a pipeline of three stages,
+ * joined by lock-free ring queues, so the first blocks are written while
+ * later requests are still being read. One thread reads the request file a
+ * line at a time, the solver threads (one for each of numThreads) solve the
+ * requests with the search given by the mode, and the calling thread
+ * writes each block. The reader and the solvers share an MPMCQueue, as do
+ * the solvers and the writer, and the window is an SPSCQueue from the
+ * writer back to the reader.
+ *
+ * Requests are solved in any order, so the writer holds blocks that are
+ * solved early until the blocks before them are written. Each request
+ * takes a token from the window queue before it is read, and gives it
+ * back once its block is written, so no more than STREAM_WINDOW requests
+ * are held at once, however large the request file is. Only the cache
+ * keeps plans between requests.
+ *
+ * @exception the first exception thrown by a stage, once every stage has
+ *            stopped
+ */
+void Output::streamFlights()
+{
+    int numSolvers{numThreads};
+    if(numSolvers <= 0)
+        numSolvers = static_cast<int>(std::thread::hardware_concurrency());
+    if(numSolvers <= 0)
+        numSolvers = 1;
+
+    MPMCQueue<std::pair<int, Request>> toSolve(STREAM_WINDOW);
+    MPMCQueue<std::pair<int, FlightPlans>> toWrite(STREAM_WINDOW);
+    SPSCQueue<int> window(STREAM_WINDOW);
+    for(int i{}; i < STREAM_WINDOW; i++)
+        window.enqueue(i);
+
+    //the first exception stops every stage
+    std::mutex errorLock;
+    std::exception_ptr error{};
+    auto fail = [&]()
+    {
+        {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if(!error)
+                error = std::current_exception();
+        }
+        window.close();
+        toSolve.close();
+        toWrite.close();
+    };
+
+    //Stage 1: read each request once a place within the window is free
+    std::thread reader([&]()
+    {
+        try
+        {
+            int numReqs{};
+            requestStream >> numReqs;
+            requestStream.ignore();
+
+            Request r{};
+            int token{};
+            for(int i{}; i < numReqs && window.dequeue(token) &&
+                    FlightRequests::readRequest(requestStream, graph.getCities(), r); i++)
+            {
+                if(!toSolve.enqueue(std::make_pair(i, r)))
+                    break;
+            }
+        }
+        catch(...)
+        {
+            fail();
+        }
+        toSolve.close();
+    });
 
-        LinkedList<Plan> p{f.getPlans()};
+    //Stage 2: solve each request, the last solver to stop closing the queue
+    std::atomic<int> solving{numSolvers};
+    std::thread* solvers = new std::thread[numSolvers];
+    for(int s{}; s < numSolvers; s++)
+    {
+        solvers[s] = std::thread([&]()
+        {
+            //each solver has its own search state
+            PathFinder* finder{nullptr};
+            PathStack* path{nullptr};
+            try
+            {
+                if(mode == SearchMode::BACKTRACK)
+                    path = new PathStack(graph);
+                else
+                    finder = new PathFinder(graph);
 
-        for(int j{}; j < 3 && j < p.length(); j++)
+                std::pair<int, Request> job{};
+                while(toSolve.dequeue(job))
+                {
+                    FlightPlans found{solveRequest(job.second, finder, path)};
+                    if(!toWrite.enqueue(std::make_pair(job.first, std::move(found))))
+                        break;
+                }
+            }
+            catch(...)
+            {
+                fail();
+            }
+            delete finder;
+            delete path;
+            if(--solving == 0)
+                toWrite.close();
+        });
+    }
+
+    //Stage 3: write the blocks in request order
+    FlightPlans* held = new FlightPlans[STREAM_WINDOW];
+    bool* ready = new bool[STREAM_WINDOW];
+    for(int i{}; i < STREAM_WINDOW; i++)
+        ready[i] = false;
+
+    try
+    {
+        std::pair<int, FlightPlans> result{};
+        int next{0};
+        while(toWrite.dequeue(result))
         {
-            o << "Path " << j+1 << ": ";
-            o << p[j];
+            held[result.first % STREAM_WINDOW] = std::move(result.second);
+            ready[result.first % STREAM_WINDOW] = true;
+            for(int slot = next % STREAM_WINDOW; ready[slot]; slot = next % STREAM_WINDOW)
+            {
+                printPlans(next + 1, held[slot]);
+                held[slot] = FlightPlans();
+                ready[slot] = false;
+                next++;
+                window.enqueue(next);
+            }
         }
-        o << std::endl << std::endl;
     }
+    catch(...)
+    {
+        fail();
+    }
+
+    reader.join();
+    for(int s{}; s < numSolvers; s++)
+        solvers[s].join();
+    delete[] solvers;
+    delete[] held;
+    delete[] ready;
+
+    if(error)
+        std::rethrow_exception(error);
 }
 
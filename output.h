@@ -5,19 +5,63 @@
 #include <flightdata.h>
 #include <flightrequests.h>
 #include <fstream>
-#include <stack.h>
+#include <flightgraph.h>
+#include <pathfinder.h>
+#include <pathstack.h>
+#include <landmarks.h>
+#include <contractionhierarchy.h>
+#include <allpairs.h>
+#include <plancache.h>
+#include <threadpool.h>
+#include <ringqueue.h>
+#include <outputwriter.h>
+#include <atomic>
 using namespace std;
 
+/**
+ * The search used by the Output class to find flight plans. BACKTRACK lists
+ * every possible journey, DIJKSTRA finds the single best journey, and
+ * K_SHORTEST finds only the journeys that will be printed. BIDIRECTIONAL
+ * also finds the single best journey, searching from both ends at once,
+ * ASTAR finds it with an A* search guided by landmarks, HIERARCHY finds it
+ * within contraction hierarchies built when the schedule is loaded, and
+ * ALL_PAIRS reads it off tables of every route built when the schedule is
+ * loaded.
+ */
+enum class SearchMode
+{
+    BACKTRACK,
+    DIJKSTRA,
+    K_SHORTEST,
+    BIDIRECTIONAL,
+    ASTAR,
+    HIERARCHY,
+    ALL_PAIRS
+};
+
 /**
  * The Output class contains the functions for outputting a list of flight
  * schedules to an output file. The class takes in three data file names and
- * constructs FlightData, FlightRequests, and a linked list of FlightPlans
+ * constructs FlightData, FlightRequests, and a Vector of FlightPlans
  * objects that will determine the most efficient flights asked for by each
  * request.
  *
  * The class contains the function for iterating through the flight data and
- * requests, using iterative backtracking to determine the most efficient
- * flight plan for the user.
+ * requests, using either iterative backtracking or a PathFinder to determine
+ * the most efficient flight plan for the user. Requests are solved in
+ * parallel on a ThreadPool, with a PathFinder for each thread searching the
+ * shared, read-only FlightGraph. Requests that can share a search are
+ * solved together on one thread: in BACKTRACK mode, one walk from each
+ * origin finds the journeys to all of its destinations, and in DIJKSTRA
+ * mode, the requests to each destination reuse the distances the
+ * PathFinder found for the first of them. Plans are kept in request order,
+ * so the order they are printed in does not change.
+ *
+ * For request files too large to hold at once, the class can instead
+ * stream the requests: each one is read, solved and written by a pipeline
+ * of threads joined by lock-free ring queues, and blocks are written as
+ * soon as the blocks before them are, so memory stays flat and output
+ * starts at once.
  *
  * This class will be used in the Sprint4: Flight Planner project
  * in SMU CSE 2341.
@@ -28,25 +72,75 @@ using namespace std;
 class Output
 {
     private:
+        bool snapshot;                      //data file is a saved graph
         FlightData data;                    //list of possible flights
         FlightRequests requests;            //list of requested schedule
-        LinkedList<FlightPlans> plans;      //final list of flights
-        ofstream o;                         //output to file
+        FlightGraph graph;                  //compact copy of the flight data
+        Landmarks landmarks;                //lower bounds for ASTAR mode
+        ContractionHierarchy costHierarchy; //HIERARCHY mode, by cost
+        ContractionHierarchy timeHierarchy; //HIERARCHY mode, by time
+        AllPairs costTable;                 //ALL_PAIRS mode, by cost
+        AllPairs timeTable;                 //ALL_PAIRS mode, by time
+        Vector<FlightPlans> plans;          //final list of flights
+        PlanCache cache;                    //plans of recent requests
+        OutputWriter o;                     //output to file
+        SearchMode mode;                    //search used to find flights
+        int numPaths;                       //paths printed for each request
+        int numThreads;                     //threads requests are solved on
+        bool streaming;                     //requests are solved within print()
+        ifstream requestStream;             //requests read while streaming
+
+        //Most requests held at once while streaming
+        static const int STREAM_WINDOW = 256;
+
+        //Groups the requests that can share a search
+        Vector<Vector<int>> groupRequests();
+
+        //Finds the plans of one request with the search of the mode
+        FlightPlans solveRequest(const Request& r, PathFinder* finder,
+                                 PathStack* path);
+
+        //Finds every journey for a group of requests from one origin
+        void solveFromOrigin(const Vector<int>& group, PathStack& path);
+
+        //Finds every journey between two cities, in the order they are found
+        Vector<Plan> journeysTo(int origin, int target, PathStack& path);
+
+        //Finds every journey from an origin to each of a set of destinations
+        void findJourneys(int origin, const Vector<int>& found,
+                          Vector<Vector<Plan>>& journeys, PathStack& path);
+
+        //Looks up the ids of the cities of a request, which are -1 if unknown
+        void findCities(const Request& r, int& origin, int& target) const;
+
+        //Returns the key of a request within the cache, or -1
+        long long cacheKey(const Request& r) const;
+
+        //Writes the block of one request to the output file
+        void printPlans(int number, const FlightPlans& f);
+
+        //Reads, solves and writes the requests as a pipeline
+        void streamFlights();
+
     public:
 
         //Constructors
         Output();
-        Output(char* dataFile, char* requestFile, char* outputFile);
+        Output(char* dataFile, char* requestFile, char* outputFile,
+               SearchMode mode = SearchMode::K_SHORTEST, int numPaths = 3,
+               int numThreads = 0, bool streaming = false,
+               WriteMode writeMode = WriteMode::BUFFERED,
+               const char* landmarkFile = nullptr);
 
-        //Iterates through the requests and calls backtrack() to find flights
+        //Iterates through the requests and finds flights for each one
         void retrieveFlights();
 
         //Finds the flights using iterative backtracking
-        FlightPlans backTrack(LinkedList<Origin> schedule, Request r);
+        FlightPlans backTrack(const Request& r, PathStack& path);
 
-        //checks if the origin is within the stack
-        bool inStack(Origin* o, Stack<Origin>& s);
-
-        //returns the data from the LinkedList of FlightPlans
+        //returns the data from the Vector of FlightPlans
         void print();
+
+        //Returns the cache of the plans found for each request
+        const PlanCache& getCache() const;
 };
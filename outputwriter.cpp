@@ -0,0 +1,306 @@
+#include "outputwriter.h"
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * Default constructor
+ *
+ * Makes a writer with no file open. The buffer is only allocated once a
+ * file is opened.
+ */
+OutputWriter::OutputWriter() : fd{-1}, mode{WriteMode::BUFFERED},
+    buffer{nullptr}, capacity{0}, used{0} {}
+
+/**
+ * Constructor with const char*, WriteMode
+ * @param fileName - the name of the file to write, which is created or
+ *                   emptied
+ * @param mode - how the buffer is written to the file
+ * @exception invalid_argument if the file cannot be opened
+ */
+OutputWriter::OutputWriter(const char* fileName, WriteMode mode) :
+    OutputWriter()
+{
+    open(fileName, mode);
+}
+
+/**
+ * Destructor
+ *
+ * Writes whatever is left within the buffer. An error while writing can no
+ * longer be thrown, so call close() first to see it.
+ */
+OutputWriter::~OutputWriter()
+{
+    try
+    {
+        close();
+    }
+    catch(const std::exception&)
+    {
+    }
+    free(buffer);
+}
+
+/**
+ * open(fileName, mode)
+ *
+ * The buffer is aligned to BLOCK_SIZE, so it can be handed to a file opened
+ * with O_DIRECT. If the file system refuses O_DIRECT, the file is opened
+ * without it and written as if BUFFERED.
+ *
+ * @param fileName - the name of the file to write, which is created or
+ *                   emptied
+ * @param mode - how the buffer is written to the file
+ * @exception invalid_argument if the file cannot be opened
+ */
+void OutputWriter::open(const char* fileName, WriteMode mode)
+{
+    close();
+
+    if(buffer == nullptr)
+    {
+        void* memory{nullptr};
+        if(posix_memalign(&memory, BLOCK_SIZE, BUFFER_SIZE) != 0)
+            throw std::bad_alloc();
+        buffer = static_cast<char*>(memory);
+        capacity = BUFFER_SIZE;
+    }
+
+    int flags{O_WRONLY | O_CREAT | O_TRUNC};
+    this->mode = WriteMode::BUFFERED;
+    if(mode == WriteMode::DIRECT)
+    {
+        fd = ::open(fileName, flags | O_DIRECT, 0644);
+        if(fd != -1)
+            this->mode = WriteMode::DIRECT;
+    }
+    if(fd == -1)
+        fd = ::open(fileName, flags, 0644);
+    if(fd == -1)
+        throw std::invalid_argument("Output file cannot be opened.");
+}
+
+/**
+ * writeAll(text, length)
+ *
+ * @param text - the characters to write
+ * @param length - the number of characters to write
+ * @exception runtime_error if the file cannot be written to
+ */
+void OutputWriter::writeAll(const char* text, std::size_t length)
+{
+    while(length > 0)
+    {
+        ssize_t written{::write(fd, text, length)};
+        if(written == -1)
+        {
+            if(errno == EINTR)
+                continue;
+
+            //some file systems only refuse O_DIRECT once they are written to
+            if(errno == EINVAL && mode == WriteMode::DIRECT)
+            {
+                stopDirect();
+                continue;
+            }
+            throw std::runtime_error("Output file cannot be written to.");
+        }
+        text += written;
+        length -= written;
+    }
+}
+
+/**
+ * drain()
+ *
+ * O_DIRECT only takes whole blocks, so in DIRECT mode the last part of a
+ * block stays at the front of the buffer until more text fills it.
+ */
+void OutputWriter::drain()
+{
+    std::size_t length{used};
+    if(mode == WriteMode::DIRECT)
+        length -= used % BLOCK_SIZE;
+
+    writeAll(buffer, length);
+    used -= length;
+    if(used > 0)
+        memmove(buffer, buffer + length, used);
+}
+
+/**
+ * stopDirect()
+ *
+ * Turns O_DIRECT off for the rest of the file.
+ *
+ * @exception runtime_error if the file cannot be changed
+ */
+void OutputWriter::stopDirect()
+{
+    int flags{fcntl(fd, F_GETFL)};
+    if(flags == -1 || fcntl(fd, F_SETFL, flags & ~O_DIRECT) == -1)
+        throw std::runtime_error("Output file cannot be written to.");
+    mode = WriteMode::BUFFERED;
+}
+
+/**
+ * write(text, length)
+ *
+ * @param text - the characters to copy into the buffer
+ * @param length - the number of characters to copy
+ * @exception runtime_error if the buffer fills and cannot be written out
+ */
+void OutputWriter::write(const char* text, std::size_t length)
+{
+    while(length > 0)
+    {
+        if(used == capacity)
+            drain();
+
+        std::size_t part{capacity - used < length ? capacity - used : length};
+        memcpy(buffer + used, text, part);
+        used += part;
+        text += part;
+        length -= part;
+    }
+}
+
+/**
+ * writeFixed(value, precision)
+ *
+ * Example: writeFixed(43.5, 2) writes "43.50".
+ *
+ * @param value - the number to write
+ * @param precision - the number of digits after the decimal point
+ */
+void OutputWriter::writeFixed(double value, int precision)
+{
+    char digits[64];
+    std::to_chars_result result{std::to_chars(digits, digits + sizeof(digits),
+        value, std::chars_format::fixed, precision)};
+    write(digits, result.ptr - digits);
+}
+
+/**
+ * operator<< overload
+ * @param text - a null-terminated string to write
+ * @return a reference to this writer
+ */
+OutputWriter& OutputWriter::operator<<(const char* text)
+{
+    write(text, strlen(text));
+    return *this;
+}
+
+/**
+ * operator<< overload
+ * @param text - a String to write
+ * @return a reference to this writer
+ */
+OutputWriter& OutputWriter::operator<<(const String& text)
+{
+    write(text.c_str(), text.size());
+    return *this;
+}
+
+/**
+ * operator<< overload
+ * @param c - a character to write
+ * @return a reference to this writer
+ */
+OutputWriter& OutputWriter::operator<<(char c)
+{
+    if(used == capacity)
+        drain();
+    buffer[used++] = c;
+    return *this;
+}
+
+/**
+ * operator<< overload
+ * @param value - a number to write, in decimal
+ * @return a reference to this writer
+ */
+OutputWriter& OutputWriter::operator<<(int value)
+{
+    char digits[16];
+    std::to_chars_result result{std::to_chars(digits, digits + sizeof(digits), value)};
+    write(digits, result.ptr - digits);
+    return *this;
+}
+
+/**
+ * flush()
+ *
+ * In DIRECT mode, a last part of a block is written with O_DIRECT turned
+ * off, since it cannot be padded out to a whole block, so flush() is best
+ * called only once the file is finished.
+ *
+ * @exception runtime_error if the file cannot be written to
+ */
+void OutputWriter::flush()
+{
+    if(fd == -1)
+        return;
+
+    drain();
+    if(used > 0)
+    {
+        stopDirect();
+        drain();
+    }
+}
+
+/**
+ * close()
+ *
+ * Does nothing if no file is open.
+ *
+ * @exception runtime_error if the file cannot be written to
+ */
+void OutputWriter::close()
+{
+    if(fd == -1)
+        return;
+
+    int closing{fd};
+    try
+    {
+        flush();
+    }
+    catch(const std::exception&)
+    {
+        fd = -1;
+        used = 0;
+        ::close(closing);
+        throw;
+    }
+    fd = -1;
+    if(::close(closing) == -1)
+        throw std::runtime_error("Output file cannot be written to.");
+}
+
+/**
+ * isOpen()
+ * @return true if a file is open to write to, false otherwise
+ */
+bool OutputWriter::isOpen() const
+{
+    return fd != -1;
+}
+
+/**
+ * getMode()
+ * @return the mode the file is written in, which is BUFFERED if O_DIRECT
+ *         was asked for but is not supported
+ */
+WriteMode OutputWriter::getMode() const
+{
+    return mode;
+}
@@ -0,0 +1,101 @@
+#ifndef OUTPUTWRITER_H
+#define OUTPUTWRITER_H
+
+#include <cstddef>
+#include <dsstring.h>
+
+/**
+ * How an OutputWriter hands its buffer to the file.
+ *
+ * BUFFERED - the buffer is written with write() each time it fills
+ * DIRECT   - the file is opened with O_DIRECT, so whole blocks of the
+ *            buffer go straight to the disk without passing through the
+ *            page cache. This suits very large result sets that will not
+ *            be read back soon. File systems that do not support O_DIRECT
+ *            are written to as if BUFFERED.
+ */
+enum class WriteMode
+{
+    BUFFERED,
+    DIRECT
+};
+
+/**
+ * The OutputWriter class writes text to a file through one large buffer
+ * that is reused for the whole file. Text is copied into the buffer by the
+ * operator<< overloads, and the buffer is written out in a single call
+ * once it fills, so a file of many short lines takes few system calls.
+ *
+ * Numbers are rendered with std::to_chars rather than iostream
+ * manipulators, and nothing is flushed until the buffer is full or
+ * flush() is called. Costs are written with writeFixed(), which gives the
+ * same digits as std::fixed with std::setprecision.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class OutputWriter
+{
+    private:
+        int fd;                     //file written to, or -1
+        WriteMode mode;             //how the buffer is written
+        char* buffer;               //text not yet written
+        std::size_t capacity;       //size of the buffer
+        std::size_t used;           //characters within the buffer
+
+        //Writes the characters to the file, retrying short writes
+        void writeAll(const char* text, std::size_t length);
+
+        //Writes the buffer, or every whole block of it in DIRECT mode
+        void drain();
+
+        //Turns O_DIRECT off, once DIRECT mode cannot be kept up
+        void stopDirect();
+
+    public:
+
+        //Size of the buffer, a multiple of the block size of O_DIRECT
+        static const std::size_t BUFFER_SIZE = 1 << 20;
+
+        //Size and alignment of the blocks written in DIRECT mode
+        static const std::size_t BLOCK_SIZE = 4096;
+
+        //Constructors and destructor
+        OutputWriter();
+        OutputWriter(const char* fileName, WriteMode mode = WriteMode::BUFFERED);
+        OutputWriter(const OutputWriter& other) = delete;
+        OutputWriter& operator=(const OutputWriter& other) = delete;
+        ~OutputWriter();
+
+        //Opens a file to write to, closing the file before it
+        void open(const char* fileName, WriteMode mode = WriteMode::BUFFERED);
+
+        //Copies characters into the buffer
+        void write(const char* text, std::size_t length);
+
+        //Writes a number with the given digits after the decimal point
+        void writeFixed(double value, int precision);
+
+        //Append text or a number to the buffer
+        OutputWriter& operator<<(const char* text);
+        OutputWriter& operator<<(const String& text);
+        OutputWriter& operator<<(char c);
+        OutputWriter& operator<<(int value);
+
+        //Writes everything within the buffer to the file
+        void flush();
+
+        //Flushes the buffer and closes the file
+        void close();
+
+        //Returns true if a file is open
+        bool isOpen() const;
+
+        //Returns the mode the file is being written in
+        WriteMode getMode() const;
+};
+
+#endif // OUTPUTWRITER_H
@@ -0,0 +1,778 @@
+#include "pathfinder.h"
+#include <landmarks.h>
+#include <contractionhierarchy.h>
+#include <allpairs.h>
+#include <stdexcept>
+#include <limits>
+
+//Distance of the cities that cannot reach the target
+static const long long UNREACHABLE = std::numeric_limits<long long>::max();
+
+/**
+ * SearchSide::start(city)
+ *
+ * @param city - the id of the city this side of the search starts from
+ */
+void SearchSide::start(int city)
+{
+    queue.clear();
+    epoch = reached.newEpoch();
+    reached.visit(city, epoch);
+    distance[city] = 0;
+    leg[city] = -1;
+    parent[city] = -1;
+    queue.push(SearchLabel{0, city});
+}
+
+/**
+ * Constructor with FlightGraph&
+ *
+ * @param graph - the flight schedule to search. The graph must outlive the
+ *                PathFinder, since a reference to it is kept.
+ */
+PathFinder::PathFinder(const FlightGraph& graph) : graph(graph),
+    distance{new long long[graph.getNumCities()]},
+    onPath{new bool[graph.getNumCities()]},
+    removedFlight{new bool[graph.getNumFlights()]}, queue{},
+    stack{new int[graph.getNumCities()]}, seen{graph.getNumCities()},
+    treeTarget{-1}, treeTimeTag{false}, forward{graph.getNumCities()},
+    backward{graph.getNumCities()}
+{
+    for(int i{}; i < graph.getNumFlights(); i++)
+        removedFlight[i] = false;
+}
+
+/**
+ * Destructor
+ */
+PathFinder::~PathFinder()
+{
+    delete[] distance;
+    delete[] onPath;
+    delete[] removedFlight;
+    delete[] stack;
+}
+
+/**
+ * distancesTo(target, timeTag)
+ *
+ * Runs Dijkstra's algorithm outward from the target city. Since every flight
+ * in the schedule has a return flight with the same cost and duration, the
+ * distance from the target to a city is the distance from that city to the
+ * target. Cities that cannot reach the target are left UNREACHABLE, and
+ * cities marked within the onPath array are not passed through.
+ *
+ * @param target - the id of the city to find the distances to
+ * @param timeTag - true if flights are weighed by time, false if by cost
+ */
+void PathFinder::distancesTo(int target, bool timeTag)
+{
+    for(int i{}; i < graph.getNumCities(); i++)
+        distance[i] = UNREACHABLE;
+
+    queue.clear();
+    distance[target] = 0;
+    queue.push(SearchLabel{0, target});
+
+    while(!queue.isEmpty())
+    {
+        SearchLabel label{queue.pop()};
+
+        //skip labels that were improved after they were pushed
+        if(label.distance > distance[label.city])
+            continue;
+
+        int end = graph.endFlight(label.city);
+        for(int f = graph.firstFlight(label.city); f < end; f++)
+        {
+            int next = graph.getTarget(f);
+            if(onPath[next])
+                continue;
+
+            long long dist = label.distance + graph.getWeight(f, timeTag);
+
+            if(dist < distance[next])
+            {
+                distance[next] = dist;
+                queue.push(SearchLabel{dist, next});
+            }
+        }
+    }
+}
+
+/**
+ * extend(route, from, target, timeTag)
+ *
+ * Extends the route from a city to the target, using the distances found by
+ * distancesTo(). At each city, the flight that leads to the smallest total
+ * is taken, with ties going to the flight that comes first within the
+ * schedule. Flights marked within the removedFlight array are not taken from
+ * the first city, and each city reached is marked within the onPath array.
+ *
+ * A flight that weighs nothing leads to a city just as far from the target,
+ * whose shortest routes may all pass back through the route so far, so it
+ * is only taken if reachesTarget() finds one that does not. The route is
+ * then the first shortest route in schedule order that never reaches a
+ * city twice, which is the one backtracking lists first.
+ *
+ * @param route - the route to add flights to
+ * @param from - the id of the city the route currently ends at
+ * @param target - the id of the city to extend the route to
+ * @param timeTag - true if flights are weighed by time, false if by cost
+ * @return true if the target was reached, false if it cannot be reached
+ */
+bool PathFinder::extend(Route& route, int from, int target, bool timeTag)
+{
+    int current = from;
+    bool first{true};
+
+    do
+    {
+        int best{-1};
+        long long bestDistance = UNREACHABLE;
+
+        int end = graph.endFlight(current);
+        for(int f = graph.firstFlight(current); f < end; f++)
+        {
+            int next = graph.getTarget(f);
+            if((next != target && onPath[next]) || (first && removedFlight[f])
+                    || distance[next] == UNREACHABLE)
+                continue;
+
+            long long weight = graph.getWeight(f, timeTag);
+            long long dist = weight + distance[next];
+            if(dist < bestDistance && (weight != 0 || reachesTarget(next, target, timeTag)))
+            {
+                best = f;
+                bestDistance = dist;
+            }
+        }
+
+        if(best == -1)
+            return false;
+
+        route.addLeg(best);
+        current = graph.getTarget(best);
+        onPath[current] = true;
+        first = false;
+    }
+    while(current != target);
+
+    return true;
+}
+
+/**
+ * reachesTarget(city, target, timeTag)
+ *
+ * Searches the cities just as far from the target as the city, over the
+ * flights that stay on a shortest route, for a way to the target that does
+ * not pass through a city marked within the onPath array. The cities of the
+ * route so far are no closer to the target than the city, so once a closer
+ * city is found, every shortest route on from it avoids them.
+ *
+ * @param city - the id of the city a flight that weighs nothing leads to
+ * @param target - the id of the city the route is extended to
+ * @param timeTag - true if flights are weighed by time, false if by cost
+ * @return true if a shortest route from the city reaches the target without
+ *         passing back through the route so far
+ */
+bool PathFinder::reachesTarget(int city, int target, bool timeTag)
+{
+    if(city == target)
+        return true;
+
+    unsigned int epoch{seen.newEpoch()};
+    seen.visit(city, epoch);
+    int size{0};
+    stack[size++] = city;
+
+    while(size > 0)
+    {
+        int current = stack[--size];
+        int end = graph.endFlight(current);
+        for(int f = graph.firstFlight(current); f < end; f++)
+        {
+            int next = graph.getTarget(f);
+            if(distance[next] == UNREACHABLE ||
+               graph.getWeight(f, timeTag) + distance[next] != distance[current])
+                continue;
+            if(next == target || (!onPath[next] && distance[next] < distance[city]))
+                return true;
+            if(onPath[next] || seen.isVisited(next, epoch))
+                continue;
+
+            seen.visit(next, epoch);
+            stack[size++] = next;
+        }
+    }
+    return false;
+}
+
+/**
+ * makePlan(route, r)
+ *
+ * @param route - the flights taken from the origin to the destination
+ * @param r - the request the route was found for
+ * @return a Plan listing the connections of the route, and its total
+ *         duration and cost
+ */
+Plan PathFinder::makePlan(const Route& route, const Request& r) const
+{
+    Plan plan(r.getOrigin(), r.getDestination());
+    int totalDuration{0};
+    double totalCost{0};
+
+    for(int i{}; i < route.getLength(); i++)
+    {
+        int leg = route.getLeg(i);
+        totalDuration += graph.getDuration(leg);
+        totalCost += graph.getCost(leg);
+
+        if(i < route.getLength() - 1)
+            plan.addConnection(graph.getName(graph.getTarget(leg)));
+    }
+
+    plan.setTotalDuration(totalDuration);
+    plan.setTotalCost(totalCost);
+    return plan;
+}
+
+/**
+ * bestPlan(r)
+ *
+ * Finds the cheapest (or shortest, if the time tag of the request is set)
+ * plan between the origin and destination of the request. The distances to
+ * the destination are kept until another search, so a run of requests to
+ * the same destination by the same metric only searches once. The route
+ * read off the distances never passes back through its origin, even over
+ * flights that weigh nothing, so the plan is the same as when searching
+ * for each, and the same one that backtracking lists first.
+ *
+ * @param r - the request containing the origin, destination, and time tag
+ * @return a FlightPlans object containing the best plan, or no plans if the
+ *         destination cannot be reached from the origin
+ */
+FlightPlans PathFinder::bestPlan(const Request& r)
+{
+    return topPlans(r, 1);
+}
+
+/**
+ * topPlans(r, k)
+ *
+ * Finds the k cheapest (or shortest, if the time tag of the request is set)
+ * plans between the origin and destination of the request with Yen's
+ * algorithm. After the best plan is found, each following plan is found by
+ * branching off the last plan at each of its cities: the route up to that
+ * city (the root) is kept, and the rest of the route is the best one that
+ * does not pass through the root or take a flight from the last city of the
+ * root that a plan with the same root already takes. The best of all the
+ * branches found so far is the next plan.
+ *
+ * @param r - the request containing the origin, destination, and time tag
+ * @param k - the largest number of plans to find
+ * @return a FlightPlans object containing up to k plans, in the same order
+ *         that backtracking would list them
+ */
+FlightPlans PathFinder::topPlans(const Request& r, int k)
+{
+    Vector<Plan> flightlist{};
+    int origin = r.getOriginId();
+    int target = r.getDestinationId();
+    int numCities = graph.getNumCities();
+
+    //look up the cities of requests that were not given ids
+    if(origin == -1)
+        origin = graph.findCity(r.getOrigin());
+    if(target == -1)
+        target = graph.findCity(r.getDestination());
+
+    if(origin == -1 || target == -1 || k < 1)
+        return FlightPlans(std::move(flightlist), r);
+
+    bool timeTag{r.getTimeTag()};
+    Route* found = new Route[k];
+    int numFound{0};
+    Heap<Route> candidates{};
+    Route branch(graph, numCities, timeTag);
+
+    //the best plan is found without any restrictions. A tree that does not
+    //block the origin is the same for every origin, so when only the best
+    //plan is wanted the tree of the last request to the target is reused
+    for(int c{}; c < numCities; c++)
+        onPath[c] = false;
+    if(k == 1)
+    {
+        if(treeTarget != target || treeTimeTag != timeTag)
+        {
+            distancesTo(target, timeTag);
+            treeTarget = target;
+            treeTimeTag = timeTag;
+        }
+    }
+    else
+    {
+        treeTarget = -1;
+        onPath[origin] = true;
+        distancesTo(target, timeTag);
+    }
+    onPath[origin] = true;
+    if(extend(branch, origin, target, timeTag))
+        found[numFound++] = branch;
+
+    while(numFound > 0 && numFound < k)
+    {
+        const Route& last{found[numFound - 1]};
+
+        //branch off the last plan at every city before the destination
+        for(int i{}; i < last.getLength(); i++)
+        {
+            int spur = (i == 0) ? origin : graph.getTarget(last.getLeg(i - 1));
+
+            //the branch may not pass through the root of the last plan
+            for(int c{}; c < numCities; c++)
+                onPath[c] = false;
+            onPath[origin] = true;
+            for(int j{}; j < i; j++)
+                onPath[graph.getTarget(last.getLeg(j))] = true;
+
+            //nor take a flight already taken by a plan with the same root
+            for(int j{}; j < numFound; j++)
+            {
+                if(found[j].getLength() > i && found[j].sharesRoot(last, i))
+                    removedFlight[found[j].getLeg(i)] = true;
+            }
+
+            distancesTo(target, timeTag);
+            branch.assignRoot(last, i);
+            if(extend(branch, spur, target, timeTag))
+                candidates.push(branch);
+
+            for(int j{}; j < numFound; j++)
+            {
+                if(found[j].getLength() > i)
+                    removedFlight[found[j].getLeg(i)] = false;
+            }
+        }
+
+        //the best branch that has not already been found is the next plan
+        bool added{false};
+        while(!added && !candidates.isEmpty())
+        {
+            Route next{candidates.pop()};
+            added = true;
+            for(int j{}; j < numFound; j++)
+            {
+                if(found[j] == next)
+                    added = false;
+            }
+            if(added)
+                found[numFound++] = std::move(next);
+        }
+
+        if(!added)
+            break;
+    }
+
+    flightlist.reserve(numFound);
+    for(int i{}; i < numFound; i++)
+        flightlist.pushBack(makePlan(found[i], r));
+
+    delete[] found;
+    return FlightPlans(std::move(flightlist), r);
+}
+
+/**
+ * step(side, other, timeTag, best, meet)
+ *
+ * Takes the closest city from the queue of one side of a bidirectional
+ * search and relaxes its flights. Whenever a flight reaches a city that the
+ * other side has also reached, the route through that city is compared to
+ * the best route found so far.
+ *
+ * @param side - the side of the search to take a step of
+ * @param other - the other side of the search
+ * @param timeTag - true if flights are weighed by time, false if by cost
+ * @param best - the distance of the best route found so far
+ * @param meet - the city the best route found so far passes through
+ */
+void PathFinder::step(SearchSide& side, const SearchSide& other, bool timeTag,
+                      long long& best, int& meet)
+{
+    SearchLabel label{side.queue.pop()};
+
+    //skip labels that were improved after they were pushed
+    if(label.distance > side.distance[label.city])
+        return;
+
+    int end = graph.endFlight(label.city);
+    for(int f = graph.firstFlight(label.city); f < end; f++)
+    {
+        int next = graph.getTarget(f);
+        long long dist = label.distance + graph.getWeight(f, timeTag);
+
+        if(!side.hasReached(next) || dist < side.distance[next])
+        {
+            side.reached.visit(next, side.epoch);
+            side.distance[next] = dist;
+            side.leg[next] = f;
+            side.parent[next] = label.city;
+            side.queue.push(SearchLabel{dist, next});
+        }
+
+        if(other.hasReached(next) && side.distance[next] + other.distance[next] < best)
+        {
+            best = side.distance[next] + other.distance[next];
+            meet = next;
+        }
+    }
+}
+
+/**
+ * bidirectionalPlan(r)
+ *
+ * Finds the cheapest (or shortest, if the time tag of the request is set)
+ * plan between the origin and destination of the request, by searching
+ * outward from both at once and always advancing the side whose closest
+ * unsettled city is nearer. Once the closest cities of the two sides are
+ * together at least as far as the best route found, no shorter route can
+ * exist, and the search stops.
+ *
+ * The route is read back from the meeting city along the flights that
+ * reached it from each side. The half found from the destination is read
+ * as the return flights of the flights that were searched, which have the
+ * same cost and duration. When several plans tie for the best, the plan
+ * returned may be a different one of them than bestPlan() returns.
+ *
+ * @param r - the request containing the origin, destination, and time tag
+ * @return a FlightPlans object containing the best plan, or no plans if the
+ *         destination cannot be reached from the origin
+ */
+FlightPlans PathFinder::bidirectionalPlan(const Request& r)
+{
+    Vector<Plan> flightlist{};
+    int origin = r.getOriginId();
+    int target = r.getDestinationId();
+
+    //look up the cities of requests that were not given ids
+    if(origin == -1)
+        origin = graph.findCity(r.getOrigin());
+    if(target == -1)
+        target = graph.findCity(r.getDestination());
+
+    if(origin == -1 || target == -1)
+        return FlightPlans(std::move(flightlist), r);
+
+    //a round trip back to the origin is not a meeting of two searches
+    if(origin == target)
+        return bestPlan(r);
+
+    bool timeTag{r.getTimeTag()};
+    long long best = UNREACHABLE;
+    int meet{-1};
+
+    forward.start(origin);
+    backward.start(target);
+    while(!forward.queue.isEmpty() && !backward.queue.isEmpty())
+    {
+        long long nearest = forward.queue.peek().distance;
+        long long nearestBack = backward.queue.peek().distance;
+        if(best != UNREACHABLE && nearest + nearestBack >= best)
+            break;
+
+        if(nearest <= nearestBack)
+            step(forward, backward, timeTag, best, meet);
+        else
+            step(backward, forward, timeTag, best, meet);
+    }
+
+    if(meet == -1)
+        return FlightPlans(std::move(flightlist), r);
+
+    Route route(graph, graph.getNumCities(), timeTag);
+    addForwardLegs(route, origin, meet);
+
+    //the return flights from the meeting city to the destination
+    for(int c = meet; c != target; c = backward.parent[c])
+    {
+        int searched = backward.leg[c];
+        int end = graph.endFlight(c);
+        for(int f = graph.firstFlight(c); f < end; f++)
+        {
+            if(graph.getTarget(f) == backward.parent[c] &&
+                    graph.getCost(f) == graph.getCost(searched) &&
+                    graph.getDuration(f) == graph.getDuration(searched))
+            {
+                route.addLeg(f);
+                break;
+            }
+        }
+    }
+
+    flightlist.pushBack(makePlan(route, r));
+    return FlightPlans(std::move(flightlist), r);
+}
+
+/**
+ * addForwardLegs(route, origin, city)
+ *
+ * @param route - the route to add the flights to
+ * @param origin - the city the forward search started from
+ * @param city - a city reached by the forward search
+ */
+void PathFinder::addForwardLegs(Route& route, int origin, int city) const
+{
+    //the flights are found from the city back to the origin
+    Vector<int> legs{};
+    for(int c = city; c != origin; c = forward.parent[c])
+        legs.pushBack(forward.leg[c]);
+
+    for(int i = legs.length() - 1; i >= 0; i--)
+        route.addLeg(legs[i]);
+}
+
+/**
+ * aStarPlan(r, landmarks)
+ *
+ * Finds the cheapest (or shortest, if the time tag of the request is set)
+ * plan between the origin and destination of the request with an A*
+ * search. Cities are settled in order of their distance from the origin
+ * plus the lower bound on their distance to the destination given by the
+ * landmarks, so the search heads toward the destination, and stops as soon
+ * as the destination is settled. The bounds never overestimate and obey the
+ * triangle inequality, so the plan found is a best plan, although when
+ * several plans tie it may be a different one of them than bestPlan()
+ * returns.
+ *
+ * @param r - the request containing the origin, destination, and time tag
+ * @param landmarks - the landmarks built for the graph of this PathFinder.
+ *                    With no landmarks, the search is Dijkstra's algorithm.
+ * @return a FlightPlans object containing the best plan, or no plans if the
+ *         destination cannot be reached from the origin
+ */
+FlightPlans PathFinder::aStarPlan(const Request& r, const Landmarks& landmarks)
+{
+    Vector<Plan> flightlist{};
+    int origin = r.getOriginId();
+    int target = r.getDestinationId();
+
+    //look up the cities of requests that were not given ids
+    if(origin == -1)
+        origin = graph.findCity(r.getOrigin());
+    if(target == -1)
+        target = graph.findCity(r.getDestination());
+
+    if(origin == -1 || target == -1)
+        return FlightPlans(std::move(flightlist), r);
+
+    //a round trip back to the origin has to leave the origin first
+    if(origin == target)
+        return bestPlan(r);
+
+    bool timeTag{r.getTimeTag()};
+    bool found{false};
+    forward.start(origin);
+
+    while(!forward.queue.isEmpty())
+    {
+        SearchLabel label{forward.queue.pop()};
+        int city{label.city};
+        long long travelled{forward.distance[city]};
+
+        //skip labels that were improved after they were pushed
+        if(label.distance > travelled + landmarks.lowerBound(city, target, timeTag))
+            continue;
+
+        if(city == target)
+        {
+            found = true;
+            break;
+        }
+
+        int end = graph.endFlight(city);
+        for(int f = graph.firstFlight(city); f < end; f++)
+        {
+            int next = graph.getTarget(f);
+            long long dist = travelled + graph.getWeight(f, timeTag);
+
+            if(!forward.hasReached(next) || dist < forward.distance[next])
+            {
+                forward.reached.visit(next, forward.epoch);
+                forward.distance[next] = dist;
+                forward.leg[next] = f;
+                forward.parent[next] = city;
+                forward.queue.push(SearchLabel{
+                    dist + landmarks.lowerBound(next, target, timeTag), next});
+            }
+        }
+    }
+
+    if(!found)
+        return FlightPlans(std::move(flightlist), r);
+
+    Route route(graph, graph.getNumCities(), timeTag);
+    addForwardLegs(route, origin, target);
+    flightlist.pushBack(makePlan(route, r));
+    return FlightPlans(std::move(flightlist), r);
+}
+
+/**
+ * hierarchyPlan(r, hierarchy)
+ *
+ * Finds the cheapest (or shortest, if the time tag of the request is set)
+ * plan between the origin and destination of the request, by searching
+ * upward through the hierarchy from both. The two sides take turns, and
+ * each stops once its closest unsettled city is no closer than the best
+ * route found, which meets at whichever city both sides have settled that
+ * gives the shortest total. The route is then unpacked from the shortcuts
+ * it uses into flights. When several plans tie, the plan returned may be a
+ * different one of them than bestPlan() returns.
+ *
+ * @param r - the request containing the origin, destination, and time tag
+ * @param hierarchy - a hierarchy built from the graph of this PathFinder,
+ *                    for the metric given by the time tag of the request
+ * @return a FlightPlans object containing the best plan, or no plans if the
+ *         destination cannot be reached from the origin
+ * @exception invalid_argument if the hierarchy was built for the other
+ *            metric, or has not been built
+ */
+FlightPlans PathFinder::hierarchyPlan(const Request& r,
+                                      const ContractionHierarchy& hierarchy)
+{
+    if(!hierarchy.isBuilt() || hierarchy.getTimeTag() != r.getTimeTag())
+        throw std::invalid_argument("PathFinder::hierarchyPlan() - hierarchy is for the wrong metric");
+
+    Vector<Plan> flightlist{};
+    int origin = r.getOriginId();
+    int target = r.getDestinationId();
+
+    //look up the cities of requests that were not given ids
+    if(origin == -1)
+        origin = graph.findCity(r.getOrigin());
+    if(target == -1)
+        target = graph.findCity(r.getDestination());
+
+    if(origin == -1 || target == -1)
+        return FlightPlans(std::move(flightlist), r);
+
+    //a round trip back to the origin is not a meeting of two searches
+    if(origin == target)
+        return bestPlan(r);
+
+    long long best = UNREACHABLE;
+    int meet{-1};
+    bool forwardTurn{true};
+
+    forward.start(origin);
+    backward.start(target);
+    while(!forward.queue.isEmpty() || !backward.queue.isEmpty())
+    {
+        //a side is finished once it cannot lead to a shorter route
+        if(!forward.queue.isEmpty() && forward.queue.peek().distance >= best)
+            forward.queue.clear();
+        if(!backward.queue.isEmpty() && backward.queue.peek().distance >= best)
+            backward.queue.clear();
+
+        bool useForward{backward.queue.isEmpty() ||
+                        (forwardTurn && !forward.queue.isEmpty())};
+        if(useForward && forward.queue.isEmpty())
+            break;
+        forwardTurn = !forwardTurn;
+
+        SearchSide& side{useForward ? forward : backward};
+        const SearchSide& other{useForward ? backward : forward};
+        SearchLabel label{side.queue.pop()};
+        int city{label.city};
+
+        //skip labels that were improved after they were pushed
+        if(label.distance > side.distance[city])
+            continue;
+
+        if(other.hasReached(city) && label.distance + other.distance[city] < best)
+        {
+            best = label.distance + other.distance[city];
+            meet = city;
+        }
+
+        int end = hierarchy.endEdge(city);
+        for(int e = hierarchy.firstEdge(city); e < end; e++)
+        {
+            int next = hierarchy.getTarget(e);
+            long long dist = label.distance + hierarchy.getWeight(e);
+
+            if(!side.hasReached(next) || dist < side.distance[next])
+            {
+                side.reached.visit(next, side.epoch);
+                side.distance[next] = dist;
+                side.leg[next] = e;
+                side.parent[next] = city;
+                side.queue.push(SearchLabel{dist, next});
+            }
+        }
+    }
+
+    if(meet == -1)
+        return FlightPlans(std::move(flightlist), r);
+
+    //the edges from the origin up to the meeting city, found in reverse
+    Vector<int> climb{};
+    for(int c = meet; c != origin; c = forward.parent[c])
+        climb.pushBack(c);
+
+    Route route(graph, graph.getNumCities(), r.getTimeTag());
+    for(int i = climb.length() - 1; i >= 0; i--)
+        hierarchy.unpack(forward.parent[climb[i]], climb[i], route);
+
+    //and back down from the meeting city to the destination
+    for(int c = meet; c != target; c = backward.parent[c])
+        hierarchy.unpack(c, backward.parent[c], route);
+
+    flightlist.pushBack(makePlan(route, r));
+    return FlightPlans(std::move(flightlist), r);
+}
+
+/**
+ * allPairsPlan(r, table)
+ *
+ * Finds the cheapest (or shortest, if the time tag of the request is set)
+ * plan between the origin and destination of the request by following the
+ * first flight of the best route from each city in the table, which is the
+ * same plan bestPlan() returns. On schedules with flights that weigh
+ * nothing, the table reads the route off its distances with the same ties
+ * as bestPlan(), so the plan is still the one backtracking lists first.
+ *
+ * @param r - the request containing the origin, destination, and time tag
+ * @param table - tables built from the graph of this PathFinder, for the
+ *                metric given by the time tag of the request
+ * @return a FlightPlans object containing the best plan, or no plans if the
+ *         destination cannot be reached from the origin
+ * @exception invalid_argument if the tables were built for the other
+ *            metric, or have not been built
+ */
+FlightPlans PathFinder::allPairsPlan(const Request& r, const AllPairs& table)
+{
+    if(!table.isBuilt() || table.getTimeTag() != r.getTimeTag())
+        throw std::invalid_argument("PathFinder::allPairsPlan() - tables are for the wrong metric");
+
+    Vector<Plan> flightlist{};
+    int origin = r.getOriginId();
+    int target = r.getDestinationId();
+
+    //look up the cities of requests that were not given ids
+    if(origin == -1)
+        origin = graph.findCity(r.getOrigin());
+    if(target == -1)
+        target = graph.findCity(r.getDestination());
+
+    if(origin == -1 || target == -1)
+        return FlightPlans(std::move(flightlist), r);
+
+    //the tables only hold routes between two different cities
+    if(origin == target)
+        return bestPlan(r);
+
+    Route route(graph, graph.getNumCities(), r.getTimeTag());
+    if(table.findRoute(origin, target, route))
+        flightlist.pushBack(makePlan(route, r));
+    return FlightPlans(std::move(flightlist), r);
+}
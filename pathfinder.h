@@ -0,0 +1,175 @@
+#ifndef PATHFINDER_H
+#define PATHFINDER_H
+
+#include <flightgraph.h>
+#include <flightplans.h>
+#include <request.h>
+#include <route.h>
+#include <heap.h>
+#include <visitedset.h>
+
+class Landmarks;
+class ContractionHierarchy;
+class AllPairs;
+
+/**
+ * A SearchLabel is an entry within the priority queue of a shortest path
+ * search, pairing a city with its tentative distance. Labels are ordered
+ * by their distance, so the Heap always returns the closest city first.
+ */
+struct SearchLabel
+{
+    long long distance;
+    int city;
+
+    bool operator<(const SearchLabel& rhs) const
+    {
+        return distance < rhs.distance;
+    }
+};
+
+/**
+ * A SearchSide holds one half of a bidirectional search: its queue, and the
+ * distance of each city it has reached along with the flight (and the city
+ * it left from) that reached it. Rather than resetting the arrays for each
+ * search, cities are marked as reached within a new epoch of a VisitedSet,
+ * so a search only touches the cities it reaches.
+ */
+struct SearchSide
+{
+    Heap<SearchLabel> queue;
+    long long* distance;        //distance from the start of this side
+    int* leg;                   //flight that reached each city
+    int* parent;                //city that flight left from
+    VisitedSet reached;         //cities with a distance in this epoch
+    unsigned int epoch;
+
+    SearchSide(int numCities) : queue{}, distance{new long long[numCities]},
+        leg{new int[numCities]}, parent{new int[numCities]},
+        reached{numCities}, epoch{0} {}
+    SearchSide(const SearchSide& other) = delete;
+    SearchSide& operator=(const SearchSide& other) = delete;
+    ~SearchSide()
+    {
+        delete[] distance;
+        delete[] leg;
+        delete[] parent;
+    }
+
+    //Empties the queue and starts the search from the city
+    void start(int city);
+
+    //Returns true if the city has been reached in this search
+    bool hasReached(int city) const { return reached.isVisited(city, epoch); }
+};
+
+/**
+ * The PathFinder class finds the best flight plans for a Request using
+ * Dijkstra's algorithm over the flight schedule held by a FlightGraph,
+ * weighting each flight by its duration or cost depending on the time tag
+ * of the Request (costs are weighed in cents). This runs in O(E log V) time
+ * per request instead of enumerating every possible journey.
+ *
+ * Because every flight is a round trip, the search runs outward from the
+ * destination to find the distance of every city to the destination. The
+ * plan is then read off from the origin by always taking the earliest
+ * flight (in schedule order) that stays on a shortest route, so the plan
+ * returned is the same one that would be listed first by backtracking.
+ * A flight that weighs nothing is only taken if a shortest route on from
+ * it does not pass back through the plan, so the plan never circles back
+ * on itself. The distances of the last search are kept, so further
+ * requests to the same destination are read off them without searching
+ * again.
+ *
+ * The k best plans are found with Yen's algorithm, which finds each plan by
+ * branching off the plans already found, so the work done depends on k
+ * rather than on the number of possible journeys.
+ *
+ * A single best plan can also be found with a bidirectional search, which
+ * runs Dijkstra's algorithm from both the origin and the destination (the
+ * schedule is undirected, since every flight is a round trip) until the two
+ * searches meet. Only the cities closer to either end than half of the best
+ * route are searched, rather than every city closer to the destination than
+ * the origin, which is far fewer on long journeys between large networks.
+ *
+ * Finally, a single best plan can be found with an A* search from the
+ * origin, guided by lower bounds on the distance left to the destination
+ * taken from the tables of a set of Landmarks. Cities whose bound shows
+ * they lead away from the destination are never settled.
+ *
+ * With a ContractionHierarchy, both halves of a bidirectional search only
+ * climb to more important cities, so each settles only a few cities.
+ *
+ * With the AllPairs tables of the graph, the best plan is read off the
+ * tables one flight at a time without any search at all.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class PathFinder
+{
+    private:
+        const FlightGraph& graph;   //flight schedule to search
+        long long* distance;        //distance of each city to the target
+        bool* onPath;               //cities that a route may not pass through
+        bool* removedFlight;        //flights that may not start a route
+        Heap<SearchLabel> queue;
+        int* stack;                 //cities left to search from
+        VisitedSet seen;            //cities searched by reachesTarget()
+        int treeTarget;             //target the distances are kept for, or -1
+        bool treeTimeTag;           //metric the distances are kept for
+        SearchSide forward;         //bidirectional search from the origin
+        SearchSide backward;        //bidirectional search from the target
+
+        //Fills the distance array with the distances to the target city
+        void distancesTo(int target, bool timeTag);
+
+        //Extends a route from a city to the target along a shortest route
+        bool extend(Route& route, int from, int target, bool timeTag);
+
+        //Returns true if a shortest route from the city to the target
+        //avoids the cities of the route so far
+        bool reachesTarget(int city, int target, bool timeTag);
+
+        //Creates the Plan for a route
+        Plan makePlan(const Route& route, const Request& r) const;
+
+        //Settles the closest city of one side of a bidirectional search
+        void step(SearchSide& side, const SearchSide& other, bool timeTag,
+                  long long& best, int& meet);
+
+        //Adds the flights that reached a city from the origin to the route
+        void addForwardLegs(Route& route, int origin, int city) const;
+
+    public:
+
+        //Constructors
+        PathFinder(const FlightGraph& graph);
+        PathFinder(const PathFinder& other) = delete;
+        PathFinder& operator=(const PathFinder& other) = delete;
+        ~PathFinder();
+
+        //Finds the cheapest or shortest plan for the request
+        FlightPlans bestPlan(const Request& r);
+
+        //Finds the k cheapest or shortest plans for the request
+        FlightPlans topPlans(const Request& r, int k);
+
+        //Finds the cheapest or shortest plan with a bidirectional search
+        FlightPlans bidirectionalPlan(const Request& r);
+
+        //Finds the cheapest or shortest plan with an A* search
+        FlightPlans aStarPlan(const Request& r, const Landmarks& landmarks);
+
+        //Finds the cheapest or shortest plan within a contraction hierarchy
+        FlightPlans hierarchyPlan(const Request& r,
+                                  const ContractionHierarchy& hierarchy);
+
+        //Finds the cheapest or shortest plan within all-pairs tables
+        FlightPlans allPairsPlan(const Request& r, const AllPairs& table);
+};
+
+#endif // PATHFINDER_H
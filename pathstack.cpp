@@ -0,0 +1,178 @@
+#include "pathstack.h"
+#include <stdexcept>
+
+/**
+ * Constructor with FlightGraph
+ *
+ * @param graph - the flight schedule to search, which must outlive the stack
+ */
+PathStack::PathStack(const FlightGraph& graph) : graph{graph},
+    steps{new Step[graph.getNumCities()]}, depth{0},
+    capacity{graph.getNumCities()}, onPath{graph.getNumCities()}, epoch{0} {}
+
+/**
+ * Destructor
+ */
+PathStack::~PathStack()
+{
+    delete[] steps;
+}
+
+/**
+ * start(city)
+ *
+ * Taking a new epoch clears the marks of any path left unfinished, without
+ * walking it.
+ *
+ * @param city - the id of the city the path starts from
+ */
+void PathStack::start(int city)
+{
+    epoch = onPath.newEpoch();
+    steps[0] = Step{city, graph.firstFlight(city), 0, 0};
+    onPath.visit(city, epoch);
+    depth = 1;
+}
+
+/**
+ * push(flight)
+ *
+ * The totals of the new level are the totals of the level below plus the
+ * cost and duration of the flight.
+ *
+ * @param flight - a flight leaving the city at the top of the path, to a
+ *                 city that is not on the path
+ * @exception out_of_range if the path is empty, or already as deep as a
+ *            path can be
+ */
+void PathStack::push(int flight)
+{
+    if(depth == 0 || depth == capacity)
+        throw std::out_of_range("PathStack::push() - path cannot be extended");
+
+    const Step& top{steps[depth - 1]};
+    int city = graph.getTarget(flight);
+    steps[depth] = Step{city, graph.firstFlight(city),
+                        top.cost + graph.getCost(flight),
+                        top.duration + graph.getDuration(flight)};
+    onPath.visit(city, epoch);
+    depth++;
+}
+
+/**
+ * pop()
+ *
+ * @exception out_of_range if the path is empty
+ */
+void PathStack::pop()
+{
+    if(depth == 0)
+        throw std::out_of_range("PathStack::pop() - path is empty");
+    depth--;
+    onPath.unvisit(steps[depth].city);
+}
+
+/**
+ * nextFlight()
+ *
+ * Moves the top level on to the flight after the one returned, so each
+ * flight of a city is only returned once while the city is on the path.
+ *
+ * @return the next flight to try from the city at the top of the path, or
+ *         -1 if every flight of the city has been tried
+ */
+int PathStack::nextFlight()
+{
+    Step& top{steps[depth - 1]};
+    if(top.next == graph.endFlight(top.city))
+        return -1;
+    return top.next++;
+}
+
+/**
+ * contains(city)
+ * @param city - the id of a city
+ * @return true if the city is on the path
+ */
+bool PathStack::contains(int city) const
+{
+    return onPath.isVisited(city, epoch);
+}
+
+/**
+ * isEmpty()
+ * @return true if there are no cities within the path
+ */
+bool PathStack::isEmpty() const
+{
+    return depth == 0;
+}
+
+/**
+ * getDepth()
+ * @return the number of cities within the path, including the origin
+ */
+int PathStack::getDepth() const
+{
+    return depth;
+}
+
+/**
+ * getCity(level)
+ * @param level - the level of the path, where 0 is the origin
+ * @return the id of the city at the level
+ */
+int PathStack::getCity(int level) const
+{
+    return steps[level].city;
+}
+
+/**
+ * getName(level)
+ * @param level - the level of the path, where 0 is the origin
+ * @return the name of the city at the level
+ */
+const String& PathStack::getName(int level) const
+{
+    return graph.getName(steps[level].city);
+}
+
+/**
+ * peek()
+ * @return the id of the city at the top of the path
+ * @exception out_of_range if the path is empty
+ */
+int PathStack::peek() const
+{
+    if(depth == 0)
+        throw std::out_of_range("PathStack::peek() - path is empty");
+    return steps[depth - 1].city;
+}
+
+/**
+ * getCost()
+ * @return the total cost of the flights taken to reach the top of the path
+ */
+double PathStack::getCost() const
+{
+    return (depth == 0) ? 0 : steps[depth - 1].cost;
+}
+
+/**
+ * getDuration()
+ * @return the total duration of the flights taken to reach the top of the
+ *         path
+ */
+int PathStack::getDuration() const
+{
+    return (depth == 0) ? 0 : steps[depth - 1].duration;
+}
+
+/**
+ * getGraph()
+ * @return the flight schedule being searched
+ */
+const FlightGraph& PathStack::getGraph() const
+{
+    return graph;
+}
@@ -0,0 +1,89 @@
+#ifndef PATHSTACK_H
+#define PATHSTACK_H
+
+#include <flightgraph.h>
+#include <dsstring.h>
+#include <visitedset.h>
+
+/**
+ * The PathStack class holds the path of a depth-first search through a
+ * FlightGraph, as used by backtracking. Each level of the stack holds only
+ * the id of a city, the next flight to try from it, and the total cost and
+ * duration of the flights taken to reach it, so pushing a city copies a few
+ * numbers instead of the city's name and list of destinations.
+ *
+ * Because the flights of each city are numbered in schedule order, trying
+ * the flights of a level in order of their numbers is the same as walking
+ * the destination list of the city, and the flights tried so far are simply
+ * the ones before the next flight of the level.
+ *
+ * The cities on the path are also marked within a VisitedSet, which is
+ * given a new epoch whenever a path is started and unmarked as cities are
+ * popped, so checking whether a city is already on the path takes constant
+ * time. Since a city is never pushed twice, a path never holds more levels
+ * than there are cities, and the levels are allocated once, when the stack
+ * is made.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class PathStack
+{
+    private:
+
+        //A level of the path
+        struct Step
+        {
+            int city;               //city reached
+            int next;               //next flight of the city to try
+            double cost;            //total cost of the flights taken
+            int duration;           //total duration of the flights taken
+        };
+
+        const FlightGraph& graph;   //flight schedule being searched
+        Step* steps;                //levels of the path, from the origin
+        int depth;                  //number of levels
+        int capacity;               //number of levels the array can hold
+        VisitedSet onPath;          //cities on the path, by id
+        unsigned int epoch;         //epoch of onPath the path is marked in
+
+    public:
+
+        //Constructors
+        PathStack(const FlightGraph& graph);
+        PathStack(const PathStack& other) = delete;
+        PathStack& operator=(const PathStack& other) = delete;
+        ~PathStack();
+
+        //Empties the path and starts it at the city
+        void start(int city);
+
+        //Takes a flight from the city at the top, pushing the city it reaches
+        void push(int flight);
+
+        //Removes the city at the top
+        void pop();
+
+        //Returns the next untried flight of the city at the top, or -1
+        int nextFlight();
+
+        //Returns true if the city is on the path
+        bool contains(int city) const;
+
+        //Returns true if there are no cities within the path
+        bool isEmpty() const;
+
+        //Getters
+        int getDepth() const;
+        int getCity(int level) const;
+        const String& getName(int level) const;
+        int peek() const;
+        double getCost() const;
+        int getDuration() const;
+        const FlightGraph& getGraph() const;
+};
+
+#endif // PATHSTACK_H
@@ -12,30 +12,26 @@ Plan::Plan(): origin{}, destination{}, connections{" -> "},
  * @param orig - the origin of the journey
  * @param dest - the destination of the journey
  */
-Plan::Plan(String orig, String dest) : origin{orig}, destination{dest},
+Plan::Plan(String orig, String dest) : origin{std::move(orig)}, destination{std::move(dest)},
     connections{" -> "},totalDuration{0}, totalCost{0} {}
 
 /**
- * Constructor with Stack<Origin>, String
- * @param stack - a stack containing the origin and connections of a journey
- * @param dest - the final destination of the journey
- */
-Plan::Plan(Stack<Origin> stack, String dest) : origin{},
-    destination{dest}, connections{" -> "},totalDuration{0}, totalCost{0}
+ * Constructor with PathStack&, int
+ *
+ * The totals are the running totals of the path plus the last flight, which
+ * adds the costs up in the same order as the flights were taken.
+ *
+ * @param path - a path containing the origin and connections of a journey
+ * @param flight - the flight from the top of the path to the destination
+ */
+Plan::Plan(const PathStack& path, int flight) : origin{path.getName(0)},
+    destination{path.getGraph().getName(path.getGraph().getTarget(flight))},
+    connections{" -> "},
+    totalDuration{path.getDuration() + path.getGraph().getDuration(flight)},
+    totalCost{path.getCost() + path.getGraph().getCost(flight)}
 {
-    LinkedList<Origin> list{stack.readStack()};
-
-    origin = list[0].getName();
-    totalDuration += list[0].getDuration();
-    totalCost += list[0].getCost();
-
-    for(int i{1}; i < list.length(); i++)
-    {
-        Origin o{list[i]};
-        addConnection(o.getName());
-        totalDuration += o.getDuration();
-        totalCost += o.getCost();
-    }
+    for(int i{1}; i < path.getDepth(); i++)
+        addConnection(path.getName(i));
 }
 
 /**
@@ -47,6 +43,15 @@ Plan::Plan(const Plan& other) :
     connections{other.connections}, totalDuration{other.totalDuration},
                                             totalCost{other.totalCost} {}
 
+/**
+ * Move constructor
+ * @param other - the Plan object to move the Strings from
+ */
+Plan::Plan(Plan&& other) noexcept :
+    origin{std::move(other.origin)}, destination{std::move(other.destination)},
+    connections{std::move(other.connections)},
+    totalDuration{other.totalDuration}, totalCost{other.totalCost} {}
+
 /**
  * operator= overload (to satisfy Rule of 3)
  * @param other - the Plan object to copy data from
@@ -62,6 +67,21 @@ Plan& Plan::operator=(const Plan& other)
     return *this;
 }
 
+/**
+ * Move assignment operator
+ * @param other - the Plan object to move the Strings from
+ * @return reference to a Plan object containing the same data as Plan& other
+ */
+Plan& Plan::operator=(Plan&& other) noexcept
+{
+    origin = std::move(other.origin);
+    destination = std::move(other.destination);
+    connections = std::move(other.connections);
+    totalDuration = other.totalDuration;
+    totalCost = other.totalCost;
+    return *this;
+}
+
 /**
  * addConnection(String)
  * Appends a connection to the connections String, and inserting a " -> " String
@@ -71,7 +91,7 @@ Plan& Plan::operator=(const Plan& other)
  */
 void Plan::addConnection(String connection)
 {
-    connections = (connections + connection + " -> ");
+    connections = connections + connection + " -> ";
 }
 
 /**
@@ -191,6 +211,25 @@ std::ostream& operator<<(std::ostream& o, const Plan& plan)
     o << plan.getOrigin() << plan.getConnections();
     o << plan.getDestination() << ".";
     o << "  Time: " << plan.totalDuration;
-    o << "  Cost: " << std::setprecision(2) << std::fixed << plan.totalCost << std::endl;
+    o << "  Cost: " << std::setprecision(2) << std::fixed << plan.totalCost << '\n';
+    return o;
+}
+
+/**
+ * operator<< overload
+ *
+ * Writes the same line as the ostream overload, with the cost rendered by
+ * OutputWriter::writeFixed() instead of iostream manipulators.
+ *
+ * @param o - the OutputWriter to add data to
+ * @param plan - the Plan object to pull data from
+ * @return the OutputWriter reference
+ */
+OutputWriter& operator<<(OutputWriter& o, const Plan& plan)
+{
+    o << plan.origin << plan.connections << plan.destination << '.';
+    o << "  Time: " << plan.totalDuration << "  Cost: ";
+    o.writeFixed(plan.totalCost, 2);
+    o << '\n';
     return o;
 }
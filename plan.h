@@ -5,8 +5,8 @@
 #include <dsstring.h>
 #include <iostream>
 #include <iomanip>
-#include <stack.h>
-#include <city.h>
+#include <pathstack.h>
+#include <outputwriter.h>
 
 
 /**
@@ -38,9 +38,11 @@ class Plan
         //Constructors and operator= (Rule of 3)
         Plan ();
         Plan (String orig, String dest);
-        Plan (Stack<Origin> stack, String dest);
+        Plan (const PathStack& path, int flight);
         Plan (const Plan& other);
+        Plan (Plan&& other) noexcept;
         Plan& operator=(const Plan& other);
+        Plan& operator=(Plan&& other) noexcept;
 
 
         //Appends the connection to the connections string
@@ -63,8 +65,9 @@ class Plan
         String getConnections() const;
         void setConnections(const String& value);
 
-        //operator<< overload
+        //operator<< overloads
         friend std::ostream& operator<<(std::ostream&, const Plan&);
+        friend OutputWriter& operator<<(OutputWriter&, const Plan&);
 };
 
 #endif // FLIGHTPLAN_H
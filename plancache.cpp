@@ -0,0 +1,242 @@
+#include "plancache.h"
+
+/**
+ * Constructor with int
+ * @param capacity - the most entries the cache holds, where 0 (or less)
+ *                   makes a cache that never holds anything
+ */
+PlanCache::PlanCache(int capacity) : capacity{capacity > 0 ? capacity : 0},
+    numEntries{0}, entries{nullptr}, numBuckets{1}, buckets{nullptr},
+    newest{-1}, oldest{-1}, hits{0}, misses{0}, lock{}
+{
+    //at least twice as many buckets as entries keeps the chains short
+    while(numBuckets < 2 * this->capacity)
+        numBuckets *= 2;
+
+    entries = new Entry[this->capacity];
+    buckets = new int[numBuckets];
+    for(int b{}; b < numBuckets; b++)
+        buckets[b] = -1;
+}
+
+/**
+ * Destructor
+ */
+PlanCache::~PlanCache()
+{
+    delete[] entries;
+    delete[] buckets;
+}
+
+/**
+ * makeKey(origin, destination, timeTag)
+ *
+ * @param origin - the id of the city the request leaves from
+ * @param destination - the id of the city the request goes to
+ * @param timeTag - true if the request is by time, false if by cost
+ * @return a key that no other request with different cities or metric has
+ */
+long long PlanCache::makeKey(int origin, int destination, bool timeTag)
+{
+    return (static_cast<long long>(origin) << 33) |
+           (static_cast<long long>(destination) << 1) | (timeTag ? 1 : 0);
+}
+
+/**
+ * bucketOf(key)
+ *
+ * @param key - the key of a request
+ * @return the bucket the key is chained within, from the high bits of the
+ *         key multiplied by a large odd constant (Fibonacci hashing)
+ */
+int PlanCache::bucketOf(long long key) const
+{
+    unsigned long long mixed{static_cast<unsigned long long>(key) * 11400714819323198485ULL};
+    return static_cast<int>(mixed >> 32) & (numBuckets - 1);
+}
+
+/**
+ * findEntry(key)
+ *
+ * @param key - the key of a request
+ * @return the index of the entry holding the key, or -1 if it is not held
+ */
+int PlanCache::findEntry(long long key) const
+{
+    for(int e = buckets[bucketOf(key)]; e != -1; e = entries[e].chain)
+    {
+        if(entries[e].key == key)
+            return e;
+    }
+    return -1;
+}
+
+/**
+ * unlink(entry)
+ *
+ * @param entry - the index of an entry within the list of recently used
+ *                entries, which is taken out of the list
+ */
+void PlanCache::unlink(int entry)
+{
+    Entry& e{entries[entry]};
+    if(e.newer != -1)
+        entries[e.newer].older = e.older;
+    else
+        newest = e.older;
+
+    if(e.older != -1)
+        entries[e.older].newer = e.newer;
+    else
+        oldest = e.newer;
+}
+
+/**
+ * pushNewest(entry)
+ *
+ * @param entry - the index of an entry that is not within the list of
+ *                recently used entries, which is put at its front
+ */
+void PlanCache::pushNewest(int entry)
+{
+    entries[entry].newer = -1;
+    entries[entry].older = newest;
+    if(newest != -1)
+        entries[newest].newer = entry;
+    newest = entry;
+    if(oldest == -1)
+        oldest = entry;
+}
+
+/**
+ * unchain(entry)
+ *
+ * @param entry - the index of an entry, which is taken out of its bucket
+ */
+void PlanCache::unchain(int entry)
+{
+    int* link = &buckets[bucketOf(entries[entry].key)];
+    while(*link != entry)
+        link = &entries[*link].chain;
+    *link = entries[entry].chain;
+}
+
+/**
+ * find(key, plans)
+ *
+ * A hit makes the entry the most recently used one.
+ *
+ * @param key - the key of a request, from makeKey()
+ * @param plans - set to a copy of the plans of the key on a hit, and left
+ *                unchanged on a miss
+ * @return true if the key was found
+ */
+bool PlanCache::find(long long key, Vector<Plan>& plans)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    int entry = (capacity > 0) ? findEntry(key) : -1;
+    if(entry == -1)
+    {
+        misses++;
+        return false;
+    }
+
+    hits++;
+    unlink(entry);
+    pushNewest(entry);
+    plans = entries[entry].plans;
+    return true;
+}
+
+/**
+ * insert(key, plans)
+ *
+ * If the key is already held (another thread found it first), the entry
+ * is left as it is, since both found the same plans.
+ *
+ * @param key - the key of a request, from makeKey()
+ * @param plans - the plans found for the request, which are copied
+ */
+void PlanCache::insert(long long key, const Vector<Plan>& plans)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    if(capacity == 0 || findEntry(key) != -1)
+        return;
+
+    //use a new entry until the cache is full, then the oldest one
+    int entry{};
+    if(numEntries < capacity)
+        entry = numEntries++;
+    else
+    {
+        entry = oldest;
+        unlink(entry);
+        unchain(entry);
+    }
+
+    Entry& e{entries[entry]};
+    e.key = key;
+    e.plans = plans;
+    int& bucket{buckets[bucketOf(key)]};
+    e.chain = bucket;
+    bucket = entry;
+    pushNewest(entry);
+}
+
+/**
+ * clear()
+ *
+ * Removes every entry and resets the counts of hits and misses.
+ */
+void PlanCache::clear()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    for(int e{}; e < numEntries; e++)
+        entries[e].plans.clear();
+    for(int b{}; b < numBuckets; b++)
+        buckets[b] = -1;
+    numEntries = 0;
+    newest = -1;
+    oldest = -1;
+    hits = 0;
+    misses = 0;
+}
+
+/**
+ * size()
+ * @return the number of entries held
+ */
+int PlanCache::size() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return numEntries;
+}
+
+/**
+ * getCapacity()
+ * @return the most entries the cache holds
+ */
+int PlanCache::getCapacity() const
+{
+    return capacity;
+}
+
+/**
+ * getHits()
+ * @return the number of lookups that found their key
+ */
+long long PlanCache::getHits() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return hits;
+}
+
+/**
+ * getMisses()
+ * @return the number of lookups that did not find their key
+ */
+long long PlanCache::getMisses() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return misses;
+}
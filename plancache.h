@@ -0,0 +1,101 @@
+#ifndef PLANCACHE_H
+#define PLANCACHE_H
+
+#include <vector.h>
+#include <plan.h>
+#include <mutex>
+
+/**
+ * The PlanCache class remembers the plans found for recent requests, so a
+ * request that repeats an earlier one is answered by copying its plans
+ * instead of searching again. Plans are looked up by a key made from the
+ * ids of the origin and destination and the metric of the request.
+ *
+ * The cache holds at most a fixed number of entries. Entries are kept in
+ * a list from the most to the least recently used, and when the cache is
+ * full the least recently used entry is replaced. Keys are found through a
+ * hash table of chained entries, so a lookup takes constant time on
+ * average. All of the entries are allocated when the cache is made.
+ *
+ * The cache is shared between the threads requests are solved on, so each
+ * lookup or insert holds a lock. Plans are copied in and out while the lock
+ * is held, but searches are run without it, so two threads that miss the
+ * same key at once both search for it, and the later insert is dropped.
+ *
+ * The number of hits and misses are counted, to show how often requests
+ * repeat.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class PlanCache
+{
+    private:
+
+        //A cached result
+        struct Entry
+        {
+            long long key;
+            Vector<Plan> plans;
+            int newer;              //entry used just after this one, or -1
+            int older;              //entry used just before this one, or -1
+            int chain;              //next entry within the same bucket, or -1
+        };
+
+        int capacity;               //most entries the cache holds
+        int numEntries;
+        Entry* entries;
+        int numBuckets;             //size of the hash table, a power of 2
+        int* buckets;               //first entry of each bucket, or -1
+        int newest;                 //most recently used entry, or -1
+        int oldest;                 //least recently used entry, or -1
+        long long hits;
+        long long misses;
+        mutable std::mutex lock;
+
+        //Returns the bucket of a key
+        int bucketOf(long long key) const;
+
+        //Returns the entry holding the key, or -1
+        int findEntry(long long key) const;
+
+        //Removes an entry from the list of recently used entries
+        void unlink(int entry);
+
+        //Adds an entry to the front of the list of recently used entries
+        void pushNewest(int entry);
+
+        //Removes an entry from its bucket
+        void unchain(int entry);
+
+    public:
+
+        //Constructors
+        PlanCache(int capacity = 1024);
+        PlanCache(const PlanCache& other) = delete;
+        PlanCache& operator=(const PlanCache& other) = delete;
+        ~PlanCache();
+
+        //Makes the key of a request between two cities by a metric
+        static long long makeKey(int origin, int destination, bool timeTag);
+
+        //Copies the plans of a key into plans, returning false on a miss
+        bool find(long long key, Vector<Plan>& plans);
+
+        //Adds the plans of a key, replacing the least recently used entry
+        void insert(long long key, const Vector<Plan>& plans);
+
+        //Removes every entry and resets the counters
+        void clear();
+
+        //Getters
+        int size() const;
+        int getCapacity() const;
+        long long getHits() const;
+        long long getMisses() const;
+};
+
+#endif // PLANCACHE_H
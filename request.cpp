@@ -3,7 +3,8 @@
 /**
  * Default constructor
  */
-Request::Request() : origin{}, destination{}, timeTag{true}{}
+Request::Request() : origin{}, destination{}, timeTag{true}, originId{-1},
+    destinationId{-1} {}
 
 
 /**
@@ -14,14 +15,37 @@ Request::Request() : origin{}, destination{}, timeTag{true}{}
  *                (true if sorted by time, false if sorted by cost)
  */
 Request::Request(String orig, String dest, bool timeTag)
-    : origin{orig}, destination{dest}, timeTag{timeTag}{}
+    : origin{std::move(orig)}, destination{std::move(dest)}, timeTag{timeTag}, originId{-1},
+      destinationId{-1} {}
+
+/**
+ * Constructor with String, String, bool, int, int
+ * @param orig - a String containing the origin city
+ * @param dest - a String containing the destination city
+ * @param timeTag - a boolean determining how the flight list will be ordered.
+ *                (true if sorted by time, false if sorted by cost)
+ * @param origId - the id of the origin city, or -1 if it has none
+ * @param destId - the id of the destination city, or -1 if it has none
+ */
+Request::Request(String orig, String dest, bool timeTag, int origId, int destId)
+    : origin{std::move(orig)}, destination{std::move(dest)}, timeTag{timeTag}, originId{origId},
+      destinationId{destId} {}
 
 /**
  * Copy constructor
  * @param other - the Request object to copy data from
  */
 Request::Request(const Request& other) : origin{other.getOrigin()},
-    destination{other.getDestination()}, timeTag{other.getTimeTag()} {}
+    destination{other.getDestination()}, timeTag{other.getTimeTag()},
+    originId{other.originId}, destinationId{other.destinationId} {}
+
+/**
+ * Move constructor
+ * @param other - the Request object to move the city names from
+ */
+Request::Request(Request&& other) noexcept : origin{std::move(other.origin)},
+    destination{std::move(other.destination)}, timeTag{other.timeTag},
+    originId{other.originId}, destinationId{other.destinationId} {}
 
 /**
  * operator= overload (to satisfy Rule of 3)
@@ -33,6 +57,23 @@ Request& Request::operator=(const Request& other)
     origin = other.getOrigin();
     destination = other.getDestination();
     timeTag = other.getTimeTag ();
+    originId = other.originId;
+    destinationId = other.destinationId;
+    return *this;
+}
+
+/**
+ * Move assignment operator
+ * @param other - the Request object to move the city names from
+ * @return reference to a Request object containing the data from Request& other
+ */
+Request& Request::operator=(Request&& other) noexcept
+{
+    origin = std::move(other.origin);
+    destination = std::move(other.destination);
+    timeTag = other.timeTag;
+    originId = other.originId;
+    destinationId = other.destinationId;
     return *this;
 }
 
@@ -97,6 +138,46 @@ void Request::setTimeTag(bool value)
     timeTag = value;
 }
 
+/**
+ * getOriginId()
+ *
+ * @return the id of the origin city, or -1 if it has none
+ */
+int Request::getOriginId() const
+{
+    return originId;
+}
+
+/**
+ * setOriginId(value)
+ *
+ * @param value - the id of the origin city
+ */
+void Request::setOriginId(int value)
+{
+    originId = value;
+}
+
+/**
+ * getDestinationId()
+ *
+ * @return the id of the destination city, or -1 if it has none
+ */
+int Request::getDestinationId() const
+{
+    return destinationId;
+}
+
+/**
+ * setDestinationId(value)
+ *
+ * @param value - the id of the destination city
+ */
+void Request::setDestinationId(int value)
+{
+    destinationId = value;
+}
+
 /**
  * operator<< overload
  * (Note: std::right, std::left, and std::setw are used for formatting)
@@ -10,6 +10,9 @@
  * destination, and a bool tag to determine whether the list of flights returned
  * should find the shortest or cheapest flights.
  *
+ * The origin and destination ids are the ids given to each city by the
+ * CityTable of the flight schedule, or -1 if the city is not within it.
+ *
  * Request class objects are used within the FlightRequests class, which takes
  * requests and aggregates them into a list that can be more easily used
  * to find multiple flight schedules for each journey request.
@@ -27,14 +30,19 @@ class Request
         String origin;
         String destination;
         bool timeTag;       //time if true, cost if false
+        int originId;
+        int destinationId;
 
     public:
 
         //Constructors
         Request();
         Request(String orig, String dest, bool timeTag);
+        Request(String orig, String dest, bool timeTag, int origId, int destId);
         Request(const Request& other);
+        Request(Request&& other) noexcept;
         Request& operator=(const Request& other);
+        Request& operator=(Request&& other) noexcept;
 
         //Getters and setters
         String getOrigin() const;
@@ -46,6 +54,12 @@ class Request
         bool getTimeTag() const;
         void setTimeTag(bool value);
 
+        int getOriginId() const;
+        void setOriginId(int value);
+
+        int getDestinationId() const;
+        void setDestinationId(int value);
+
         //Operator<< overload
         friend std::ostream& operator<<(std::ostream& o, const Request& r);
 
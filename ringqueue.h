@@ -0,0 +1,570 @@
+#ifndef RINGQUEUE
+#define RINGQUEUE
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+/**
+ * ringQueueBackoff(tries)
+ *
+ * Waits a little before a queue is tried again. The first tries only
+ * yield, so a short wait is cheap, and later tries sleep, so a thread
+ * that waits on an idle stage of a pipeline does not hold a core.
+ *
+ * @param tries : the number of tries so far, which is counted up
+ */
+inline void ringQueueBackoff(int& tries)
+{
+    if(tries < 64)
+        std::this_thread::yield();
+    else
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    tries++;
+}
+
+/**
+ * ringQueueCapacity(capacity)
+ *
+ * @param capacity : the most elements a queue is asked to hold
+ * @return the smallest power of two that is at least capacity and 2
+ */
+inline std::size_t ringQueueCapacity(int capacity)
+{
+    std::size_t size{2};
+    while(static_cast<int>(size) < capacity)
+        size <<= 1;
+    return size;
+}
+
+/**
+ * The SPSCQueue class provides a first in, first out (FIFO) queue between
+ * exactly one producing thread and one consuming thread. Elements are kept
+ * within a ring buffer allocated when the queue is made, and no locks are
+ * taken: the producer only writes the tail and the consumer only writes
+ * the head, so each side just reads the other's index.
+ *
+ * The class keeps the interface of Queue<T>. enqueue() waits while the
+ * queue is full and dequeue() waits while it is empty; tryEnqueue() and
+ * tryDequeue() return at once instead. Once the queue is closed, nothing
+ * more is taken, and the waiting forms of dequeue() stop once the queue is
+ * empty. peek() and the dequeues may only be called by the consumer, and
+ * the enqueues only by the producer.
+ *
+ * The capacity is rounded up to a power of two so an index is found with
+ * a mask.
+ *
+ * The SPSCQueue class will be used between the stages of the streaming
+ * pipeline of the Sprint4: Flight Planner project in SMU CSE2341.
+ *
+ * By: Oisin Coveney
+ * Created:         October 17, 2026
+ * Last Modified:   October 17, 2026
+ */
+template<class T>
+class SPSCQueue
+{
+    public:
+        //Constructors
+        SPSCQueue(int capacity);
+        SPSCQueue(const SPSCQueue& other) = delete;
+        SPSCQueue& operator=(const SPSCQueue& other) = delete;
+        ~SPSCQueue();
+
+        bool tryEnqueue(T& d);
+        bool tryDequeue(T& d);
+        bool enqueue(T d);
+        bool dequeue(T& d);
+        T dequeue();
+        T peek();
+        bool isEmpty() const;
+        void close();
+        bool isClosed() const;
+        int getCapacity() const;
+
+    private:
+        T* data;                //ring buffer of elements
+        std::size_t mask;       //capacity - 1
+
+        //the consumer's and the producer's indices are kept on separate
+        //cache lines, so neither side's writes slow down the other
+        alignas(64) std::atomic<std::size_t> head;  //next entry to dequeue
+        alignas(64) std::atomic<std::size_t> tail;  //next entry to enqueue
+        alignas(64) std::atomic<bool> closed;
+};
+
+/**
+ * Constructor with int
+ *
+ * @param capacity : the most elements the queue holds, rounded up to a
+ *                   power of two
+ */
+template<class T>
+SPSCQueue<T>::SPSCQueue(int capacity) : data{nullptr},
+    mask{ringQueueCapacity(capacity) - 1}, head{0}, tail{0}, closed{false}
+{
+    data = new T[mask + 1];
+}
+
+/**
+ * Destructor
+ */
+template<class T>
+SPSCQueue<T>::~SPSCQueue()
+{
+    delete[] data;
+}
+
+/**
+ * tryEnqueue(T& d)
+ *
+ * Moves the data to the end of the queue if there is room, without waiting.
+ *
+ * @param d : the data to add, which is left unchanged if it is not added
+ * @return true if the data was added, false if the queue was full or closed
+ */
+template<class T>
+bool SPSCQueue<T>::tryEnqueue(T& d)
+{
+    if(closed.load(std::memory_order_relaxed))
+        return false;
+
+    std::size_t t{tail.load(std::memory_order_relaxed)};
+    if(t - head.load(std::memory_order_acquire) > mask)
+        return false;
+
+    data[t & mask] = std::move(d);
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * tryDequeue(T& d)
+ *
+ * Removes the entry at the beginning of the queue if there is one, without
+ * waiting.
+ *
+ * @param d : set to the data in the former first entry of the queue
+ * @return true if an entry was removed, false if the queue was empty
+ */
+template<class T>
+bool SPSCQueue<T>::tryDequeue(T& d)
+{
+    std::size_t h{head.load(std::memory_order_relaxed)};
+    if(h == tail.load(std::memory_order_acquire))
+        return false;
+
+    d = std::move(data[h & mask]);
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * enqueue(T d)
+ *
+ * Adds the data to the end of the queue, waiting while the queue is full.
+ *
+ * @param d : the data to add to the end of the queue
+ * @return true if the data was added, false if the queue was closed
+ */
+template<class T>
+bool SPSCQueue<T>::enqueue(T d)
+{
+    for(int tries{}; !tryEnqueue(d); ringQueueBackoff(tries))
+    {
+        if(closed.load(std::memory_order_relaxed))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * dequeue(T& d)
+ *
+ * Removes the entry at the beginning of the queue, waiting while the queue
+ * is empty and still open.
+ *
+ * @param d : set to the data in the former first entry of the queue
+ * @return true if an entry was removed, false if the queue is closed and
+ *         empty, in which case d is left unchanged
+ */
+template<class T>
+bool SPSCQueue<T>::dequeue(T& d)
+{
+    for(int tries{}; !tryDequeue(d); ringQueueBackoff(tries))
+    {
+        //entries enqueued before the queue was closed are still taken
+        if(closed.load(std::memory_order_acquire))
+            return tryDequeue(d);
+    }
+    return true;
+}
+
+/**
+ * dequeue()
+ *
+ * Removes the entry at the beginning of the queue, waiting while the queue
+ * is empty and still open.
+ *
+ * @return the data in the former first entry of the queue
+ * @exception std::out_of_range if the queue is closed and empty
+ */
+template<class T>
+T SPSCQueue<T>::dequeue()
+{
+    T d{};
+    if(!dequeue(d))
+        throw std::out_of_range("SPSCQueue<T>::dequeue() - queue is closed and empty");
+    return d;
+}
+
+/**
+ * peek()
+ *
+ * @return the data in the first entry of the queue
+ * @exception std::out_of_range if the queue is empty
+ */
+template<class T>
+T SPSCQueue<T>::peek()
+{
+    std::size_t h{head.load(std::memory_order_relaxed)};
+    if(h == tail.load(std::memory_order_acquire))
+        throw std::out_of_range("SPSCQueue<T>::peek() - queue is empty");
+    return data[h & mask];
+}
+
+/**
+ * isEmpty()
+ *
+ * @return true if the queue held no entries when it was looked at, false
+ *         if not
+ */
+template<class T>
+bool SPSCQueue<T>::isEmpty() const
+{
+    return head.load(std::memory_order_acquire) ==
+           tail.load(std::memory_order_acquire);
+}
+
+/**
+ * close()
+ *
+ * Stops the queue from taking any more entries, so threads waiting on it
+ * return once it is empty.
+ */
+template<class T>
+void SPSCQueue<T>::close()
+{
+    closed.store(true, std::memory_order_release);
+}
+
+/**
+ * isClosed()
+ *
+ * @return true if the queue has been closed, false if not
+ */
+template<class T>
+bool SPSCQueue<T>::isClosed() const
+{
+    return closed.load(std::memory_order_acquire);
+}
+
+/**
+ * getCapacity()
+ *
+ * @return the most entries the queue holds
+ */
+template<class T>
+int SPSCQueue<T>::getCapacity() const
+{
+    return static_cast<int>(mask + 1);
+}
+
+
+/**
+ * The MPMCQueue class provides a first in, first out (FIFO) queue that any
+ * number of threads may enqueue into and dequeue from at once, without
+ * locks. Elements are kept within a ring buffer allocated when the queue
+ * is made.
+ *
+ * Each slot of the buffer carries a sequence number that says whose turn
+ * it is: a slot is free for the producer that claims position p when its
+ * sequence is p, and holds data for the consumer that claims position p
+ * when its sequence is p + 1. Threads claim positions with a compare and
+ * swap on the shared indices, and only the thread that claimed a slot
+ * touches its data, so a slot is never read while it is being written.
+ *
+ * The class keeps the interface of Queue<T> and SPSCQueue<T>. peek() copies
+ * the first entry, so it may only be called while no other thread is
+ * dequeuing.
+ *
+ * The MPMCQueue class will be used between the stages of the streaming
+ * pipeline of the Sprint4: Flight Planner project in SMU CSE2341.
+ *
+ * By: Oisin Coveney
+ * Created:         October 17, 2026
+ * Last Modified:   October 17, 2026
+ */
+template<class T>
+class MPMCQueue
+{
+    public:
+        //Constructors
+        MPMCQueue(int capacity);
+        MPMCQueue(const MPMCQueue& other) = delete;
+        MPMCQueue& operator=(const MPMCQueue& other) = delete;
+        ~MPMCQueue();
+
+        bool tryEnqueue(T& d);
+        bool tryDequeue(T& d);
+        bool enqueue(T d);
+        bool dequeue(T& d);
+        T dequeue();
+        T peek();
+        bool isEmpty() const;
+        void close();
+        bool isClosed() const;
+        int getCapacity() const;
+
+    private:
+        //A slot of the ring buffer and whose turn it is
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence;
+            T data;
+        };
+
+        Cell* cells;            //ring buffer of elements
+        std::size_t mask;       //capacity - 1
+
+        alignas(64) std::atomic<std::size_t> head;  //next entry to dequeue
+        alignas(64) std::atomic<std::size_t> tail;  //next entry to enqueue
+        alignas(64) std::atomic<bool> closed;
+};
+
+/**
+ * Constructor with int
+ *
+ * @param capacity : the most elements the queue holds, rounded up to a
+ *                   power of two
+ */
+template<class T>
+MPMCQueue<T>::MPMCQueue(int capacity) : cells{nullptr},
+    mask{ringQueueCapacity(capacity) - 1}, head{0}, tail{0}, closed{false}
+{
+    cells = new Cell[mask + 1];
+    for(std::size_t i{}; i <= mask; i++)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+/**
+ * Destructor
+ */
+template<class T>
+MPMCQueue<T>::~MPMCQueue()
+{
+    delete[] cells;
+}
+
+/**
+ * tryEnqueue(T& d)
+ *
+ * Moves the data to the end of the queue if there is room, without waiting.
+ *
+ * @param d : the data to add, which is left unchanged if it is not added
+ * @return true if the data was added, false if the queue was full or closed
+ */
+template<class T>
+bool MPMCQueue<T>::tryEnqueue(T& d)
+{
+    if(closed.load(std::memory_order_relaxed))
+        return false;
+
+    std::size_t pos{tail.load(std::memory_order_relaxed)};
+    while(true)
+    {
+        Cell& cell{cells[pos & mask]};
+        std::size_t seq{cell.sequence.load(std::memory_order_acquire)};
+        std::ptrdiff_t diff{static_cast<std::ptrdiff_t>(seq - pos)};
+
+        //the slot is free: claim it, or retry from wherever tail moved to
+        if(diff == 0)
+        {
+            if(tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.data = std::move(d);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        //the slot still holds the entry from a lap ago, so the queue is full
+        else if(diff < 0)
+            return false;
+        else
+            pos = tail.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * tryDequeue(T& d)
+ *
+ * Removes the entry at the beginning of the queue if there is one, without
+ * waiting.
+ *
+ * @param d : set to the data in the former first entry of the queue
+ * @return true if an entry was removed, false if the queue was empty
+ */
+template<class T>
+bool MPMCQueue<T>::tryDequeue(T& d)
+{
+    std::size_t pos{head.load(std::memory_order_relaxed)};
+    while(true)
+    {
+        Cell& cell{cells[pos & mask]};
+        std::size_t seq{cell.sequence.load(std::memory_order_acquire)};
+        std::ptrdiff_t diff{static_cast<std::ptrdiff_t>(seq - (pos + 1))};
+
+        //the slot holds data: claim it, then hand it back a lap later
+        if(diff == 0)
+        {
+            if(head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                d = std::move(cell.data);
+                cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        //the slot has not been filled yet, so the queue is empty
+        else if(diff < 0)
+            return false;
+        else
+            pos = head.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * enqueue(T d)
+ *
+ * Adds the data to the end of the queue, waiting while the queue is full.
+ *
+ * @param d : the data to add to the end of the queue
+ * @return true if the data was added, false if the queue was closed
+ */
+template<class T>
+bool MPMCQueue<T>::enqueue(T d)
+{
+    for(int tries{}; !tryEnqueue(d); ringQueueBackoff(tries))
+    {
+        if(closed.load(std::memory_order_relaxed))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * dequeue(T& d)
+ *
+ * Removes the entry at the beginning of the queue, waiting while the queue
+ * is empty and still open.
+ *
+ * @param d : set to the data in the former first entry of the queue
+ * @return true if an entry was removed, false if the queue is closed and
+ *         empty, in which case d is left unchanged
+ */
+template<class T>
+bool MPMCQueue<T>::dequeue(T& d)
+{
+    for(int tries{}; !tryDequeue(d); ringQueueBackoff(tries))
+    {
+        //entries enqueued before the queue was closed are still taken
+        if(closed.load(std::memory_order_acquire))
+            return tryDequeue(d);
+    }
+    return true;
+}
+
+/**
+ * dequeue()
+ *
+ * Removes the entry at the beginning of the queue, waiting while the queue
+ * is empty and still open.
+ *
+ * @return the data in the former first entry of the queue
+ * @exception std::out_of_range if the queue is closed and empty
+ */
+template<class T>
+T MPMCQueue<T>::dequeue()
+{
+    T d{};
+    if(!dequeue(d))
+        throw std::out_of_range("MPMCQueue<T>::dequeue() - queue is closed and empty");
+    return d;
+}
+
+/**
+ * peek()
+ *
+ * @return the data in the first entry of the queue
+ * @exception std::out_of_range if the queue is empty
+ */
+template<class T>
+T MPMCQueue<T>::peek()
+{
+    std::size_t pos{head.load(std::memory_order_relaxed)};
+    Cell& cell{cells[pos & mask]};
+    if(cell.sequence.load(std::memory_order_acquire) != pos + 1)
+        throw std::out_of_range("MPMCQueue<T>::peek() - queue is empty");
+    return cell.data;
+}
+
+/**
+ * isEmpty()
+ *
+ * @return true if the queue held no entries when it was looked at, false
+ *         if not
+ */
+template<class T>
+bool MPMCQueue<T>::isEmpty() const
+{
+    std::size_t pos{head.load(std::memory_order_acquire)};
+    return cells[pos & mask].sequence.load(std::memory_order_acquire) != pos + 1;
+}
+
+/**
+ * close()
+ *
+ * Stops the queue from taking any more entries, so threads waiting on it
+ * return once it is empty.
+ */
+template<class T>
+void MPMCQueue<T>::close()
+{
+    closed.store(true, std::memory_order_release);
+}
+
+/**
+ * isClosed()
+ *
+ * @return true if the queue has been closed, false if not
+ */
+template<class T>
+bool MPMCQueue<T>::isClosed() const
+{
+    return closed.load(std::memory_order_acquire);
+}
+
+/**
+ * getCapacity()
+ *
+ * @return the most entries the queue holds
+ */
+template<class T>
+int MPMCQueue<T>::getCapacity() const
+{
+    return static_cast<int>(mask + 1);
+}
+
+#endif
@@ -0,0 +1,220 @@
+#include "route.h"
+#include <stdexcept>
+
+/**
+ * Default constructor
+ */
+Route::Route() : graph{nullptr}, timeTag{true}, distance{0}, length{0},
+    capacity{0}, legs{nullptr} {}
+
+/**
+ * Constructor with FlightGraph&, int, bool
+ * @param graph - the graph the flights of the route are numbered within
+ * @param capacity - the largest number of flights the route will hold
+ * @param timeTag - true if the route is weighed by time, false if by cost
+ */
+Route::Route(const FlightGraph& graph, int capacity, bool timeTag)
+    : graph{&graph}, timeTag{timeTag}, distance{0}, length{0},
+      capacity{capacity}, legs{new int[capacity]} {}
+
+/**
+ * Copy constructor
+ *
+ * The copy only allocates enough room for the flights of the other route,
+ * so copies of a large scratch route stay small.
+ *
+ * @param other - the Route to copy data from
+ */
+Route::Route(const Route& other) : graph{other.graph}, timeTag{other.timeTag},
+    distance{other.distance}, length{other.length}, capacity{other.length},
+    legs{new int[other.length]}
+{
+    for(int i{}; i < length; i++)
+        legs[i] = other.legs[i];
+}
+
+/**
+ * Move constructor
+ * @param other - the Route to take the flights of, which is left empty
+ */
+Route::Route(Route&& other) noexcept : graph{other.graph},
+    timeTag{other.timeTag}, distance{other.distance}, length{other.length},
+    capacity{other.capacity}, legs{other.legs}
+{
+    other.distance = 0;
+    other.length = 0;
+    other.capacity = 0;
+    other.legs = nullptr;
+}
+
+/**
+ * operator= overload (to satisfy Rule of 3)
+ * @param other - the Route to copy data from
+ * @return a reference to this Route, containing the data of the other route
+ */
+Route& Route::operator=(const Route& other)
+{
+    if(this != &other)
+    {
+        if(capacity < other.length)
+        {
+            delete[] legs;
+            capacity = other.length;
+            legs = new int[capacity];
+        }
+        graph = other.graph;
+        timeTag = other.timeTag;
+        distance = other.distance;
+        length = other.length;
+        for(int i{}; i < length; i++)
+            legs[i] = other.legs[i];
+    }
+    return *this;
+}
+
+/**
+ * Move assignment operator
+ * @param other - the Route to take the flights of, which is left empty
+ * @return a reference to this Route, containing the flights of the other route
+ */
+Route& Route::operator=(Route&& other) noexcept
+{
+    if(this != &other)
+    {
+        delete[] legs;
+        graph = other.graph;
+        timeTag = other.timeTag;
+        distance = other.distance;
+        length = other.length;
+        capacity = other.capacity;
+        legs = other.legs;
+
+        other.distance = 0;
+        other.length = 0;
+        other.capacity = 0;
+        other.legs = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * Destructor
+ */
+Route::~Route()
+{
+    delete[] legs;
+}
+
+/**
+ * addLeg(flight)
+ *
+ * @param flight - the number of the flight to add to the end of the route
+ * @exception out_of_range if the route is already at capacity
+ */
+void Route::addLeg(int flight)
+{
+    if(length == capacity)
+        throw std::out_of_range("Route::addLeg() - route is full");
+
+    legs[length] = flight;
+    distance += graph->getWeight(flight, timeTag);
+    length++;
+}
+
+/**
+ * assignRoot(other, n)
+ *
+ * Replaces the flights of this route with the first n flights of the other
+ * route.
+ *
+ * @param other - the route to take the flights from
+ * @param n - the number of flights to take
+ */
+void Route::assignRoot(const Route& other, int n)
+{
+    length = 0;
+    distance = 0;
+    for(int i{}; i < n; i++)
+        addLeg(other.legs[i]);
+}
+
+/**
+ * sharesRoot(other, n)
+ *
+ * @param other - the route to compare this route to
+ * @param n - the number of flights to compare
+ * @return true if both routes have at least n flights and take the same
+ *         first n flights, false otherwise
+ */
+bool Route::sharesRoot(const Route& other, int n) const
+{
+    if(length < n || other.length < n)
+        return false;
+
+    for(int i{}; i < n; i++)
+    {
+        if(legs[i] != other.legs[i])
+            return false;
+    }
+    return true;
+}
+
+/**
+ * getDistance()
+ * @return the total duration or cost (in cents) of the flights in the route
+ */
+long long Route::getDistance() const
+{
+    return distance;
+}
+
+/**
+ * getLength()
+ * @return the number of flights within the route
+ */
+int Route::getLength() const
+{
+    return length;
+}
+
+/**
+ * getLeg(index)
+ * @param index - the index of the flight within the route
+ * @return the number of the flight at the index
+ */
+int Route::getLeg(int index) const
+{
+    return legs[index];
+}
+
+/**
+ * operator< overload
+ *
+ * Compares the distance of each route, then the numbers of their flights
+ * from the first flight onward.
+ *
+ * @param rhs - the Route to compare this Route to
+ * @return true if this route comes before rhs, false otherwise
+ */
+bool Route::operator<(const Route& rhs) const
+{
+    if(distance != rhs.distance)
+        return distance < rhs.distance;
+
+    for(int i{}; i < length && i < rhs.length; i++)
+    {
+        if(legs[i] != rhs.legs[i])
+            return legs[i] < rhs.legs[i];
+    }
+    return length < rhs.length;
+}
+
+/**
+ * operator== overload
+ * @param rhs - the Route to compare this Route to
+ * @return true if both routes take the same flights, false otherwise
+ */
+bool Route::operator==(const Route& rhs) const
+{
+    return length == rhs.length && sharesRoot(rhs, length);
+}
@@ -0,0 +1,66 @@
+#ifndef ROUTE_H
+#define ROUTE_H
+
+#include <flightgraph.h>
+
+/**
+ * The Route class holds a journey found by the PathFinder as the sequence of
+ * flights (legs) taken from the origin, each given by its number within a
+ * FlightGraph. The distance of a Route is the total duration of its flights
+ * if it was made with the time tag set, or their total cost otherwise. Costs
+ * are counted in whole cents, so that routes with the same cost are compared
+ * exactly rather than by the rounding of their floating point totals.
+ *
+ * Routes are ordered by their total distance, and routes with the same
+ * distance are ordered by the numbers of their flights. Since the flights of
+ * a city are numbered in schedule order, this is the same order in which
+ * backtracking through the schedule would list them, so searches that
+ * return Routes in this order return the same plans.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class Route
+{
+    private:
+        const FlightGraph* graph;   //graph the flights are numbered within
+        bool timeTag;               //time if true, cost if false
+        long long distance;         //total weight of the flights
+        int length;                 //number of flights taken
+        int capacity;               //number of flights the array can hold
+        int* legs;                  //the flights taken
+
+    public:
+
+        //Constructors and Rule of 3
+        Route();
+        Route(const FlightGraph& graph, int capacity, bool timeTag);
+        Route(const Route& other);
+        Route(Route&& other) noexcept;
+        Route& operator=(const Route& other);
+        Route& operator=(Route&& other) noexcept;
+        ~Route();
+
+        //Adds a flight to the end of the route
+        void addLeg(int flight);
+
+        //Replaces this route with the first n flights of another route
+        void assignRoot(const Route& other, int n);
+
+        //Returns true if both routes take the same first n flights
+        bool sharesRoot(const Route& other, int n) const;
+
+        //Getters
+        long long getDistance() const;
+        int getLength() const;
+        int getLeg(int index) const;
+
+        //Comparison operators
+        bool operator<(const Route& rhs) const;
+        bool operator==(const Route& rhs) const;
+};
+
+#endif // ROUTE_H
@@ -1,12 +1,12 @@
 #ifndef STACK
 #define STACK
 
-#include "linkedlist.h"
+#include "vector.h"
 
 /**
  * The Stack class provides an implementation of a stack, which is a
- * last in, first out (LIFO) data structure. A Stack uses a LinkedList
- * to provide its functionality.
+ * last in, first out (LIFO) data structure. A Stack uses a Vector
+ * to provide its functionality, so its entries can be read by index.
  *
  * The Stack class will be used in the Sprint4: Flight Planner project
  * in SMU CSE2341.
@@ -23,14 +23,14 @@ class Stack
         T& peek();
         void push(T);
         bool isEmpty();
-        LinkedList<T> readStack() const;
+        const Vector<T>& readStack() const;
         int size() const;
         T front();
         ~Stack();
 
         T* peekPointer();
     private:
-        LinkedList<T> data;
+        Vector<T> data;
 
 };
 
@@ -58,6 +58,14 @@ T& Stack<T>::peek()
     return data.back();
 }
 
+/**
+ * peekPointer()
+ *
+ * The pointer is invalidated by the next push(), since the underlying
+ * Vector may grow.
+ *
+ * @return a pointer to the last entry of the stack
+ */
 template<class T>
 T* Stack<T>::peekPointer()
 {
@@ -92,14 +100,15 @@ bool Stack<T>::isEmpty()
 /**
  * readStack()
  *
- * Returns the underlying LinkedList. This function will be used
+ * Returns the underlying Vector. This function will be used
  * mostly within the Flight Planner Project
  *
- * @return the underlying LinkedList of <T> values
+ * @return a reference to the underlying Vector of <T> values, from the
+ *         bottom of the stack to the top
  *
  */
 template<class T>
-LinkedList<T> Stack<T>::readStack() const
+const Vector<T>& Stack<T>::readStack() const
 {
     return data;
 }
@@ -107,7 +116,7 @@ LinkedList<T> Stack<T>::readStack() const
 /**
  * size()
  *
- * @return the size of the underlying linked list under the Stack class
+ * @return the size of the underlying vector under the Stack class
  */
 template<class T>
 int Stack<T>::size() const
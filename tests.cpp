@@ -1,7 +1,32 @@
 #include <catch.hpp>
 #include <linkedlist.h>
+#include <nodepool.h>
 #include <stack.h>
+#include <vector.h>
 #include <queue.h>
+#include <heap.h>
+#include <pathfinder.h>
+#include <citytable.h>
+#include <mappedfile.h>
+#include <outputwriter.h>
+#include <threadpool.h>
+#include <visitedset.h>
+#include <landmarks.h>
+#include <contractionhierarchy.h>
+#include <allpairs.h>
+#include <plancache.h>
+#include <ringqueue.h>
+#include <output.h>
+#include <networkgenerator.h>
+#include <benchmark.h>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
 
 using namespace std;
 
@@ -34,6 +59,35 @@ TEST_CASE("LinkedList", "[LinkedList]")
         }
     }
 
+    SECTION("Move constructor and move assignment")
+    {
+        LinkedList<int> moved(std::move(list));
+        REQUIRE(moved.length() == 25);
+        REQUIRE(moved.back() == 24);
+        REQUIRE(list.length() == 0);
+        REQUIRE(list.getHead() == nullptr);
+
+        list = std::move(moved);
+        REQUIRE(list.length() == 25);
+        REQUIRE(list.get(12) == 12);
+        REQUIRE(moved.length() == 0);
+    }
+
+    SECTION("pushBack(T&&) and emplaceBack() with Strings")
+    {
+        LinkedList<String> names;
+        String name("Madison Park");
+        names.pushBack(std::move(name));
+        names.emplaceBack("Jamesville");
+        names.emplaceBack("Sandgap", 4);
+
+        REQUIRE(names.length() == 3);
+        REQUIRE(names.front() == "Madison Park");
+        REQUIRE(name.size() == 0);
+        REQUIRE(names.get(1) == "Jamesville");
+        REQUIRE(names.back() == "Sand");
+    }
+
     SECTION("Element access")
     {
         SECTION("front() - access front element")
@@ -247,6 +301,194 @@ TEST_CASE("LinkedList", "[LinkedList]")
 
 }
 
+TEST_CASE("NodePool", "[NodePool]")
+{
+    NodePool<String> pool(4);
+    LinkedList<String> list(&pool);
+    for(int i{}; i < 10; i++)
+        list.emplaceBack("a long city name that does not fit inline", i + 1);
+
+    SECTION("Nodes come from the pool, and go back to it when removed")
+    {
+        REQUIRE(pool.size() == 10);
+        REQUIRE(list.get(9) == "a long cit");
+
+        list.remove(4);
+        list.popFront();
+        REQUIRE(pool.size() == 8);
+        REQUIRE(list.front() == "a ");
+        REQUIRE(list.length() == 8);
+
+        list.pushBack(String("Sandgap"));
+        REQUIRE(pool.size() == 9);
+        REQUIRE(list.back() == "Sandgap");
+    }
+
+    SECTION("clear() releases every Node, and the list can be refilled")
+    {
+        list.clear();
+        REQUIRE(pool.size() == 0);
+        REQUIRE(list.length() == 0);
+        REQUIRE(list.getHead() == nullptr);
+        REQUIRE(list.getTail() == nullptr);
+
+        list.emplaceBack("Jamesville");
+        REQUIRE(pool.size() == 1);
+        REQUIRE(list.front() == list.back());
+    }
+
+    SECTION("copies allocate their own Nodes, moves take the pool along")
+    {
+        LinkedList<String> copy(list);
+        REQUIRE(copy.getPool() == nullptr);
+        REQUIRE(copy.length() == 10);
+        REQUIRE(pool.size() == 10);
+
+        LinkedList<String> moved(std::move(list));
+        REQUIRE(moved.getPool() == &pool);
+        moved.popBack();
+        REQUIRE(pool.size() == 9);
+    }
+
+    SECTION("setPool() - only an empty list can change pools")
+    {
+        REQUIRE_THROWS_AS(list.setPool(nullptr), std::logic_error);
+
+        LinkedList<String> other;
+        other.setPool(&pool);
+        other.emplaceBack("Madison Park");
+        REQUIRE(pool.size() == 11);
+    }
+}
+
+TEST_CASE("Vector", "[Vector]")
+{
+    Vector<int> vec;
+    for(int i{}; i < 25; i++)
+        vec.pushBack(i);
+
+    SECTION("Element access")
+    {
+        REQUIRE(vec.length() == 25);
+        REQUIRE(vec.front() == 0);
+        REQUIRE(vec.back() == 24);
+        REQUIRE(vec[10] == 10);
+        REQUIRE(vec.get(20) == 20);
+        REQUIRE_THROWS_AS(vec.get(25), std::out_of_range);
+
+        vec[10] = 100;
+        REQUIRE(vec.get(10) == 100);
+    }
+
+    SECTION("find() and uniquePushBack()")
+    {
+        REQUIRE(vec.find(7) == 7);
+        REQUIRE(vec.find(30) == -1);
+        REQUIRE(vec.uniquePushBack(7) == 7);
+        REQUIRE(vec.length() == 25);
+        REQUIRE(vec.uniquePushBack(30) == 25);
+        REQUIRE(vec.length() == 26);
+    }
+
+    SECTION("popBack(), resize() and clear()")
+    {
+        REQUIRE(vec.popBack() == 24);
+        REQUIRE(vec.length() == 24);
+
+        vec.resize(30, -1);
+        REQUIRE(vec.length() == 30);
+        REQUIRE(vec[29] == -1);
+        vec.resize(5, -1);
+        REQUIRE(vec.back() == 4);
+
+        vec.clear();
+        REQUIRE(vec.empty());
+        REQUIRE_THROWS_AS(vec.popBack(), std::out_of_range);
+    }
+
+    SECTION("Copying and moving")
+    {
+        Vector<int> copy(vec);
+        copy[0] = 50;
+        REQUIRE(vec[0] == 0);
+
+        Vector<int> moved(std::move(copy));
+        REQUIRE(moved.length() == 25);
+        REQUIRE(moved[0] == 50);
+        REQUIRE(copy.empty());
+
+        copy = vec;
+        REQUIRE(copy.length() == 25);
+        vec = std::move(moved);
+        REQUIRE(vec[0] == 50);
+    }
+
+    SECTION("reserve() and pushing an element of the vector")
+    {
+        vec.reserve(100);
+        REQUIRE(vec.length() == 25);
+
+        Vector<String> names;
+        names.pushBack("Sandgap");
+        for(int i{}; i < 20; i++)
+            names.pushBack(names[0]);
+        REQUIRE(names.length() == 21);
+        REQUIRE(names[20] == "Sandgap");
+    }
+}
+
+TEST_CASE("String", "[String]")
+{
+    String shortName("Sandgap");
+    String longName("Llanfairpwllgwyngyll-gogerychwyrndrobwll");
+
+    SECTION("Copies keep their own characters, inline or on the heap")
+    {
+        String a(shortName);
+        String b(longName);
+        a[0] = 's';
+        b[0] = 'l';
+        REQUIRE(shortName == "Sandgap");
+        REQUIRE(longName.size() == 40);
+        REQUIRE(a == "sandgap");
+        REQUIRE(b.c_str()[0] == 'l');
+
+        a = longName;
+        b = shortName;
+        REQUIRE(a == longName);
+        REQUIRE(b == "Sandgap");
+        REQUIRE(b.size() == 7);
+    }
+
+    SECTION("Moved-from Strings are left empty")
+    {
+        String a(std::move(shortName));
+        String b(std::move(longName));
+        REQUIRE(a == "Sandgap");
+        REQUIRE(b.size() == 40);
+        REQUIRE(shortName.size() == 0);
+        REQUIRE(longName == "");
+
+        shortName = std::move(b);
+        REQUIRE(shortName.size() == 40);
+        REQUIRE(b.size() == 0);
+    }
+
+    SECTION("Concatenation, substring and clear()")
+    {
+        String joined = shortName + " -> " + longName;
+        REQUIRE(joined.size() == 51);
+        REQUIRE(joined.substring(0, 7) == "Sandgap");
+        REQUIRE(joined.substring(11, 15) == "Llan");
+
+        joined.clear();
+        REQUIRE(joined.size() == 0);
+        REQUIRE(joined == "");
+        joined = "Jamesville";
+        REQUIRE(joined == "Jamesville");
+    }
+}
+
 TEST_CASE("Stack", "[Stack]")
 {
     Stack<int> st;
@@ -329,3 +571,1605 @@ TEST_CASE("Queue", "[Queue]")
         REQUIRE(qu.isEmpty());
     }
 }
+
+TEST_CASE("SPSCQueue", "[SPSCQueue]")
+{
+    SPSCQueue<int> qu(10);
+
+    for(int i{}; i < 10; i++)
+    {
+        qu.enqueue(i);
+    }
+
+    SECTION("dequeue()")
+    {
+        int x;
+        while(!qu.isEmpty())
+        {
+            x = qu.dequeue();
+        }
+        REQUIRE(x == 9);
+    }
+
+    SECTION("peek()")
+    {
+        REQUIRE(qu.peek() == 0);
+        qu.dequeue();
+        REQUIRE(qu.peek() == 1);
+    }
+
+    SECTION("tryEnqueue() - the capacity is rounded up to a power of two")
+    {
+        REQUIRE(qu.getCapacity() == 16);
+        int d{};
+        for(int i{10}; i < 16; i++)
+        {
+            d = i;
+            REQUIRE(qu.tryEnqueue(d));
+        }
+        d = 16;
+        REQUIRE_FALSE(qu.tryEnqueue(d));
+        REQUIRE(d == 16);
+        REQUIRE(qu.dequeue() == 0);
+        REQUIRE(qu.tryEnqueue(d));
+    }
+
+    SECTION("close() - what is left is dequeued, and nothing more is taken")
+    {
+        int d{};
+        qu.close();
+        REQUIRE_FALSE(qu.enqueue(10));
+        for(int i{}; i < 10; i++)
+            REQUIRE(qu.dequeue() == i);
+        REQUIRE_FALSE(qu.dequeue(d));
+        REQUIRE_THROWS_AS(qu.dequeue(), std::out_of_range);
+        REQUIRE_THROWS_AS(qu.peek(), std::out_of_range);
+    }
+
+    SECTION("stress - one producer and one consumer through a small buffer")
+    {
+        SPSCQueue<long long> shared(4);
+        const long long count{200000};
+        std::thread producer([&]()
+        {
+            for(long long i{}; i < count; i++)
+                shared.enqueue(i);
+            shared.close();
+        });
+
+        long long d{}, expected{};
+        bool ordered{true};
+        while(shared.dequeue(d))
+            ordered = ordered && d == expected++;
+        producer.join();
+        REQUIRE(ordered);
+        REQUIRE(expected == count);
+        REQUIRE(shared.isEmpty());
+    }
+}
+
+TEST_CASE("MPMCQueue", "[MPMCQueue]")
+{
+    MPMCQueue<int> qu(10);
+
+    for(int i{}; i < 10; i++)
+    {
+        qu.enqueue(i);
+    }
+
+    SECTION("dequeue()")
+    {
+        int x;
+        while(!qu.isEmpty())
+        {
+            x = qu.dequeue();
+        }
+        REQUIRE(x == 9);
+    }
+
+    SECTION("peek()")
+    {
+        REQUIRE(qu.peek() == 0);
+        qu.dequeue();
+        REQUIRE(qu.peek() == 1);
+    }
+
+    SECTION("tryEnqueue() - the queue is reused over many laps")
+    {
+        int d{};
+        for(int i{10}; i < 1000; i++)
+        {
+            REQUIRE(qu.dequeue() == i - 10);
+            d = i;
+            REQUIRE(qu.tryEnqueue(d));
+        }
+        while(qu.tryEnqueue(d))
+            ;
+        REQUIRE(qu.getCapacity() == 16);
+        REQUIRE(qu.peek() == 990);
+    }
+
+    SECTION("close() - what is left is dequeued, and nothing more is taken")
+    {
+        int d{};
+        qu.close();
+        REQUIRE(qu.isClosed());
+        REQUIRE_FALSE(qu.enqueue(10));
+        for(int i{}; i < 10; i++)
+            REQUIRE(qu.dequeue() == i);
+        REQUIRE_FALSE(qu.dequeue(d));
+        REQUIRE_THROWS_AS(qu.dequeue(), std::out_of_range);
+    }
+
+    SECTION("stress - every entry is dequeued once, in order per producer")
+    {
+        const int numProducers{4}, numConsumers{4}, perProducer{50000};
+        MPMCQueue<long long> shared(8);
+        std::atomic<int> producing{numProducers};
+
+        std::vector<std::thread> producers;
+        for(int p{}; p < numProducers; p++)
+        {
+            producers.emplace_back([&, p]()
+            {
+                for(long long i{}; i < perProducer; i++)
+                    shared.enqueue(p * static_cast<long long>(perProducer) + i);
+                if(--producing == 0)
+                    shared.close();
+            });
+        }
+
+        //each consumer checks that the entries of a producer arrive in order
+        std::vector<std::vector<long long>> taken(numConsumers);
+        std::vector<int> ordered(numConsumers, 1);
+        std::vector<std::thread> consumers;
+        for(int c{}; c < numConsumers; c++)
+        {
+            consumers.emplace_back([&, c]()
+            {
+                std::vector<long long> last(numProducers, -1);
+                long long d{};
+                while(shared.dequeue(d))
+                {
+                    int p{static_cast<int>(d / perProducer)};
+                    if(d <= last[p])
+                        ordered[c] = 0;
+                    last[p] = d;
+                    taken[c].push_back(d);
+                }
+            });
+        }
+        for(std::thread& t : producers)
+            t.join();
+        for(std::thread& t : consumers)
+            t.join();
+
+        std::vector<int> seen(numProducers * perProducer, 0);
+        bool once{true};
+        for(int c{}; c < numConsumers; c++)
+        {
+            REQUIRE(ordered[c] == 1);
+            for(long long d : taken[c])
+                once = once && seen[d]++ == 0;
+        }
+        REQUIRE(once);
+        REQUIRE(std::count(seen.begin(), seen.end(), 1) == numProducers * perProducer);
+        REQUIRE(shared.isEmpty());
+    }
+}
+
+TEST_CASE("Heap", "[Heap]")
+{
+    Heap<int> heap;
+    int values[10]{7, 3, 9, 0, 5, 8, 1, 6, 2, 4};
+
+    for(int i{}; i < 10; i++)
+    {
+        heap.push(values[i]);
+    }
+
+    SECTION("pop() - returns elements in increasing order")
+    {
+        for(int i{}; i < 10; i++)
+            REQUIRE(heap.pop() == i);
+        REQUIRE(heap.isEmpty());
+    }
+
+    SECTION("peek()")
+    {
+        REQUIRE(heap.peek() == 0);
+        heap.pop();
+        REQUIRE(heap.peek() == 1);
+    }
+
+    SECTION("push() - growing past the initial capacity")
+    {
+        for(int i{}; i < 50; i++)
+            heap.push(-i);
+        REQUIRE(heap.size() == 60);
+        REQUIRE(heap.peek() == -49);
+    }
+
+    SECTION("copy constructor and clear()")
+    {
+        Heap<int> copy(heap);
+        heap.clear();
+        REQUIRE(heap.isEmpty());
+        REQUIRE(copy.size() == 10);
+        REQUIRE(copy.pop() == 0);
+    }
+}
+
+TEST_CASE("CityTable", "[CityTable]")
+{
+    CityTable table;
+    table.intern("Sandgap");
+    table.intern("Madison Park");
+    table.intern("Jamesville");
+
+    SECTION("intern() - ids are given in the order names are first seen")
+    {
+        REQUIRE(table.intern("Madison Park") == 1);
+        REQUIRE(table.intern("Rock Hill") == 3);
+        REQUIRE(table.size() == 4);
+    }
+
+    SECTION("find() and getName()")
+    {
+        REQUIRE(table.find("Jamesville") == 2);
+        REQUIRE(table.find("Rock Hill") == -1);
+        REQUIRE(table.getName(0) == "Sandgap");
+        REQUIRE_THROWS(table.getName(3));
+    }
+
+    SECTION("intern() - growing past the initial capacity")
+    {
+        char name[8]{"city"};
+        for(int i{}; i < 100; i++)
+        {
+            name[4] = 'a' + i / 26;
+            name[5] = 'a' + i % 26;
+            REQUIRE(table.intern(name) == i + 3);
+        }
+        REQUIRE(table.size() == 103);
+        REQUIRE(table.find("Sandgap") == 0);
+        REQUIRE(table.getName(102) == "citydv");
+    }
+
+    SECTION("copy constructor")
+    {
+        CityTable copy(table);
+        table.intern("Rock Hill");
+        REQUIRE(copy.size() == 3);
+        REQUIRE(copy.find("Rock Hill") == -1);
+        REQUIRE(copy.find("Madison Park") == 1);
+    }
+}
+
+TEST_CASE("MappedFile", "[MappedFile]")
+{
+    {
+        std::ofstream file("mappedfile_test.txt");
+        file << "2\r\nSandgap|Madison Park|282.50|322\r\nJamesville| 43|50";
+    }
+    MappedFile file("mappedfile_test.txt");
+
+    SECTION("nextField() and number parsing")
+    {
+        REQUIRE(file.nextInt() == 2);
+        REQUIRE(file.nextField('|') == "Sandgap");
+        REQUIRE(file.nextField('|') == "Madison Park");
+        REQUIRE(file.nextDouble('|') == 282.5);
+        REQUIRE(file.nextInt() == 322);
+        REQUIRE(file.nextField('|') == "Jamesville");
+        REQUIRE(file.nextDouble('|') == 43);
+        REQUIRE_FALSE(file.atEnd());
+        REQUIRE(file.nextInt() == 50);
+        REQUIRE(file.atEnd());
+        REQUIRE(file.nextField().empty());
+    }
+
+    SECTION("missing file")
+    {
+        REQUIRE_THROWS_AS(MappedFile("mappedfile_missing.txt"),
+                          std::invalid_argument);
+    }
+    remove("mappedfile_test.txt");
+}
+
+TEST_CASE("OutputWriter", "[OutputWriter]")
+{
+    auto readFile = [](const char* fileName)
+    {
+        std::ifstream file(fileName);
+        return std::string{std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>()};
+    };
+
+    SECTION("operator<<() - text and numbers are written as an ostream would")
+    {
+        {
+            OutputWriter out("outputwriter_test.txt");
+            out << "Flight " << 12 << ": " << String("Sandgap") << ',' << -7 << '\n';
+        }
+        REQUIRE(readFile("outputwriter_test.txt") == "Flight 12: Sandgap,-7\n");
+    }
+
+    SECTION("writeFixed() - the same digits as std::fixed and setprecision")
+    {
+        std::mt19937 random(41);
+        std::uniform_real_distribution<double> costs(0, 5000);
+        std::ostringstream expected;
+        {
+            OutputWriter out("outputwriter_test.txt");
+            double values[] = {0, 43, 0.005, 0.015, 2.675, 282.5, 1e9 + 0.125};
+            for(double value : values)
+            {
+                out.writeFixed(value, 2);
+                out << '\n';
+                expected << std::setprecision(2) << std::fixed << value << '\n';
+            }
+            for(int i{}; i < 1000; i++)
+            {
+                double value{costs(random)};
+                out.writeFixed(value, 2);
+                out << '\n';
+                expected << value << '\n';
+            }
+        }
+        REQUIRE(readFile("outputwriter_test.txt") == expected.str());
+    }
+
+    SECTION("Plan - the line matches the ostream overload")
+    {
+        Plan plan("Sandgap", "Jamesville");
+        plan.addConnection("Madison Park");
+        plan.setTotalDuration(401);
+        plan.setTotalCost(309.5);
+        std::ostringstream expected;
+        expected << plan;
+        {
+            OutputWriter out("outputwriter_test.txt");
+            out << plan;
+        }
+        REQUIRE(readFile("outputwriter_test.txt") == expected.str());
+    }
+
+    SECTION("write() - more than the buffer holds, in both modes")
+    {
+        std::string expected{};
+        for(int i{}; expected.size() < 3 * OutputWriter::BUFFER_SIZE; i++)
+            expected += "Path " + std::to_string(i) + ": Sandgap -> Jamesville.\n";
+
+        WriteMode modes[] = {WriteMode::BUFFERED, WriteMode::DIRECT};
+        for(WriteMode mode : modes)
+        {
+            OutputWriter out("outputwriter_test.txt", mode);
+            REQUIRE(out.isOpen());
+            for(std::size_t i{}; i < expected.size(); i += 1000)
+                out.write(expected.data() + i, std::min<std::size_t>(1000, expected.size() - i));
+            out.close();
+            REQUIRE_FALSE(out.isOpen());
+            REQUIRE(readFile("outputwriter_test.txt") == expected);
+        }
+    }
+
+    SECTION("open() - a file that cannot be made is refused")
+    {
+        REQUIRE_THROWS_AS(OutputWriter("outputwriter_missing/test.txt"),
+                          std::invalid_argument);
+    }
+    remove("outputwriter_test.txt");
+}
+
+TEST_CASE("FlightGraph", "[FlightGraph]")
+{
+    FlightData data;
+    data.addRoundTrip("Sandgap", "Madison Park", 282.5, 322);
+    data.addRoundTrip("Sandgap", "Jamesville", 43, 50);
+    data.addRoundTrip("Madison Park", "Jamesville", 27, 79);
+    FlightGraph graph(data);
+    REQUIRE(graph.save("flightgraph_test.bin"));
+
+    SECTION("save() and load() - the snapshot holds the same graph")
+    {
+        REQUIRE(FlightGraph::isSnapshot("flightgraph_test.bin"));
+        FlightGraph loaded;
+        REQUIRE(loaded.load("flightgraph_test.bin"));
+        REQUIRE(loaded.getNumCities() == 3);
+        REQUIRE(loaded.getNumFlights() == 6);
+        for(int c{}; c < graph.getNumCities(); c++)
+        {
+            REQUIRE(loaded.getName(c) == graph.getName(c));
+            REQUIRE(loaded.findCity(graph.getName(c)) == c);
+            REQUIRE(loaded.firstFlight(c) == graph.firstFlight(c));
+            REQUIRE(loaded.endFlight(c) == graph.endFlight(c));
+        }
+        for(int f{}; f < graph.getNumFlights(); f++)
+        {
+            REQUIRE(loaded.getTarget(f) == graph.getTarget(f));
+            REQUIRE(loaded.getCost(f) == graph.getCost(f));
+            REQUIRE(loaded.getDuration(f) == graph.getDuration(f));
+            REQUIRE(loaded.getWeight(f, false) == graph.getWeight(f, false));
+        }
+        REQUIRE(loaded.findCity("Nowhere") == -1);
+    }
+
+    SECTION("load() - damaged snapshots and text files are not loaded")
+    {
+        {
+            std::fstream file("flightgraph_test.bin",
+                              std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(-12, std::ios::end);
+            file.put('#');
+        }
+        FlightGraph loaded;
+        REQUIRE_FALSE(loaded.load("flightgraph_test.bin"));
+        REQUIRE(loaded.getNumCities() == 0);
+
+        {
+            std::ofstream file("flightgraph_test.txt");
+            file << "1\nSandgap|Jamesville|43|50\n";
+        }
+        REQUIRE_FALSE(FlightGraph::isSnapshot("flightgraph_test.txt"));
+        REQUIRE_FALSE(loaded.load("flightgraph_test.txt"));
+        REQUIRE_FALSE(loaded.load("flightgraph_missing.bin"));
+        remove("flightgraph_test.txt");
+    }
+
+    SECTION("Output - a snapshot gives the same plans as the schedule")
+    {
+        std::ofstream dataFile("flightgraph_data.txt");
+        dataFile << "3\nSandgap|Madison Park|282|322\nSandgap|Jamesville|43|50\n"
+                 << "Madison Park|Jamesville|27|79\n";
+        dataFile.close();
+        std::ofstream requestFile("flightgraph_requests.txt");
+        requestFile << "3\nSandgap|Madison Park|C\nJamesville|Sandgap|T\n"
+                    << "Sandgap|Nowhere|T\n";
+        requestFile.close();
+
+        char text[] = "flightgraph_data.txt";
+        FlightData parsed(text);
+        FlightGraph parsedGraph(parsed);
+        REQUIRE(parsedGraph.save("flightgraph_data.bin"));
+
+        char snapshot[] = "flightgraph_data.bin";
+        char requests[] = "flightgraph_requests.txt";
+        char textOutput[] = "flightgraph_text.out";
+        char snapshotOutput[] = "flightgraph_snapshot.out";
+        {
+            Output fromText(text, requests, textOutput);
+            fromText.print();
+            Output fromSnapshot(snapshot, requests, snapshotOutput);
+            fromSnapshot.print();
+        }
+
+        std::ifstream first(textOutput), second(snapshotOutput);
+        std::string expected{std::istreambuf_iterator<char>(first),
+                             std::istreambuf_iterator<char>()};
+        std::string actual{std::istreambuf_iterator<char>(second),
+                           std::istreambuf_iterator<char>()};
+        REQUIRE_FALSE(expected.empty());
+        REQUIRE(actual == expected);
+
+        remove("flightgraph_data.txt");
+        remove("flightgraph_data.bin");
+        remove("flightgraph_requests.txt");
+        remove("flightgraph_text.out");
+        remove("flightgraph_snapshot.out");
+    }
+    remove("flightgraph_test.bin");
+}
+
+TEST_CASE("ThreadPool", "[ThreadPool]")
+{
+    ThreadPool pool(4);
+    int counts[1000]{};
+    int workers[1000]{};
+
+    SECTION("run() - every task runs exactly once")
+    {
+        pool.run(1000, [&](int worker, int task)
+        {
+            counts[task]++;
+            workers[task] = worker;
+        });
+        for(int i{}; i < 1000; i++)
+        {
+            REQUIRE(counts[i] == 1);
+            REQUIRE(workers[i] >= 0);
+            REQUIRE(workers[i] < pool.size());
+        }
+    }
+
+    SECTION("run() - the pool can be reused, and fewer tasks than workers")
+    {
+        for(int n{}; n < 20; n++)
+            pool.run(n % 3, [&](int, int task) { counts[task]++; });
+        REQUIRE(counts[0] == 13);
+        REQUIRE(counts[1] == 6);
+        REQUIRE(counts[2] == 0);
+    }
+
+    SECTION("run() - exceptions are rethrown after the other tasks run")
+    {
+        REQUIRE_THROWS_AS(pool.run(100, [&](int, int task)
+        {
+            if(task == 50)
+                throw std::out_of_range("task 50");
+            counts[task]++;
+        }), std::out_of_range);
+        REQUIRE(counts[49] == 1);
+        REQUIRE(counts[99] == 1);
+        REQUIRE(counts[50] == 0);
+    }
+}
+
+TEST_CASE("VisitedSet", "[VisitedSet]")
+{
+    VisitedSet visited(10);
+    unsigned int first{visited.newEpoch()};
+    visited.visit(3, first);
+
+    SECTION("isVisited() - marks only hold within their epoch")
+    {
+        REQUIRE(visited.isVisited(3, first));
+        REQUIRE_FALSE(visited.isVisited(4, first));
+
+        unsigned int second{visited.newEpoch()};
+        REQUIRE(second != first);
+        REQUIRE_FALSE(visited.isVisited(3, second));
+
+        visited.visit(4, second);
+        REQUIRE(visited.isVisited(3, first));
+        REQUIRE(visited.isVisited(4, second));
+    }
+}
+
+//Writes a random schedule in which some flights cost or take nothing, along
+//with a request by each metric between every pair of its cities
+void writeZeroWeightFiles(const char* dataName, const char* requestName,
+                          int numCities, int numLegs, unsigned int seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> city(0, numCities - 1);
+    std::uniform_int_distribution<int> cents(0, 400);
+    std::uniform_int_distribution<int> minutes(0, 90);
+    std::bernoulli_distribution free(0.3);
+
+    std::ofstream dataFile(dataName);
+    dataFile << numLegs << '\n';
+    for(int i{}; i < numLegs; i++)
+    {
+        int a{city(random)}, b{city(random)};
+        if(a == b)
+            b = (a + 1) % numCities;
+        dataFile << "City" << a << "|City" << b << "|"
+                 << (free(random) ? 0 : cents(random)) / 100.0 << "|"
+                 << (free(random) ? 0 : minutes(random)) << '\n';
+    }
+    dataFile.close();
+
+    std::ofstream requestFile(requestName);
+    requestFile << 2 * numCities * (numCities - 1) << '\n';
+    for(int a{}; a < numCities; a++)
+    {
+        for(int b{}; b < numCities; b++)
+        {
+            if(a != b)
+                requestFile << "City" << a << "|City" << b << "|C\n"
+                            << "City" << a << "|City" << b << "|T\n";
+        }
+    }
+    requestFile.close();
+}
+
+//Returns the file written by the planner in the given mode
+std::string planWith(char* data, char* requests, SearchMode mode, int numPaths)
+{
+    char output[] = "zeroweight_output.txt";
+    {
+        Output o(data, requests, output, mode, numPaths, 1);
+        o.print();
+    }
+    std::ifstream file(output);
+    std::string text{std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>()};
+    remove(output);
+    return text;
+}
+
+TEST_CASE("PathFinder", "[PathFinder]")
+{
+    FlightData data;
+    data.addRoundTrip("Sandgap", "Madison Park", 282, 322);
+    data.addRoundTrip("Sandgap", "Jamesville", 43, 50);
+    data.addRoundTrip("Madison Park", "Jamesville", 27, 79);
+    data.addRoundTrip("Jamesville", "Sandgap", 43, 50);
+
+    FlightGraph graph(data);
+    PathFinder finder(graph);
+
+    SECTION("bestPlan() - cheapest plan")
+    {
+        Vector<Plan> plans{finder.bestPlan(
+                        Request("Sandgap", "Madison Park", false)).getPlans()};
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getConnections() == " -> Jamesville -> ");
+        REQUIRE(plans[0].getTotalCost() == 70);
+    }
+
+    SECTION("topPlans() - plans are listed in order, ties by schedule order")
+    {
+        Vector<Plan> plans{finder.topPlans(
+                        Request("Sandgap", "Jamesville", true), 3).getPlans()};
+        REQUIRE(plans.length() == 3);
+        REQUIRE(plans[0].getTotalDuration() == 50);
+        REQUIRE(plans[1].getTotalDuration() == 50);
+        REQUIRE(plans[2].getTotalDuration() == 401);
+        REQUIRE(plans[2].getConnections() == " -> Madison Park -> ");
+    }
+
+    SECTION("topPlans() - fewer plans than requested")
+    {
+        Vector<Plan> plans{finder.topPlans(
+                        Request("Sandgap", "Madison Park", true), 10).getPlans()};
+        REQUIRE(plans.length() == 3);
+        REQUIRE(plans[0].getTotalDuration() == 129);
+        REQUIRE(plans[2].getTotalDuration() == 322);
+    }
+
+    SECTION("unknown cities have no plans")
+    {
+        REQUIRE(finder.topPlans(Request("Sandgap", "Nowhere", true), 3)
+                .getPlans().length() == 0);
+        REQUIRE(finder.bidirectionalPlan(Request("Nowhere", "Sandgap", true))
+                .getPlans().length() == 0);
+    }
+
+    SECTION("bidirectionalPlan() - same totals as bestPlan()")
+    {
+        Vector<Plan> plans{finder.bidirectionalPlan(
+                        Request("Sandgap", "Madison Park", false)).getPlans()};
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getOrigin() == "Sandgap");
+        REQUIRE(plans[0].getConnections() == " -> Jamesville -> ");
+        REQUIRE(plans[0].getDestination() == "Madison Park");
+        REQUIRE(plans[0].getTotalCost() == 70);
+        REQUIRE(plans[0].getTotalDuration() == 129);
+
+        plans = finder.bidirectionalPlan(
+                    Request("Madison Park", "Sandgap", true)).getPlans();
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getTotalDuration() == 129);
+    }
+
+    SECTION("bestPlan() - requests to one destination reuse its distances")
+    {
+        Request requests[]{Request("Sandgap", "Madison Park", false),
+                           Request("Jamesville", "Madison Park", false),
+                           Request("Madison Park", "Madison Park", false),
+                           Request("Jamesville", "Madison Park", true),
+                           Request("Jamesville", "Sandgap", true)};
+        for(const Request& r : requests)
+        {
+            PathFinder fresh(graph);
+            Vector<Plan> reused{finder.bestPlan(r).getPlans()};
+            Vector<Plan> plans{fresh.bestPlan(r).getPlans()};
+            REQUIRE(reused.length() == plans.length());
+            for(int i{}; i < plans.length(); i++)
+            {
+                REQUIRE(reused[i].getConnections() == plans[i].getConnections());
+                REQUIRE(reused[i].getTotalCost() == plans[i].getTotalCost());
+                REQUIRE(reused[i].getTotalDuration() == plans[i].getTotalDuration());
+            }
+        }
+
+        //free flights tie cities with their neighbours, and the route read
+        //off the kept distances must not pass back through the origin
+        FlightData free;
+        free.addRoundTrip("A2", "CityA0", 0.0, 10);
+        free.addRoundTrip("CityA0", "A1", 3.9, 10);
+        free.addRoundTrip("A2", "Ozark", 100, 10);
+        free.addRoundTrip("Ozark", "A1", 16.2, 10);
+        FlightGraph freeGraph(free);
+        PathFinder freeFinder(freeGraph);
+        const char* origins[]{"CityA0", "A2", "Ozark", "CityA0"};
+        const char* routes[]{" -> ", " -> CityA0 -> ", " -> ", " -> "};
+        double costs[]{3.9, 3.9, 16.2, 3.9};
+        for(int i{}; i < 4; i++)
+        {
+            Vector<Plan> plans{freeFinder.bestPlan(Request(origins[i], "A1", false)).getPlans()};
+            REQUIRE(plans.length() == 1);
+            REQUIRE(plans[0].getConnections() == routes[i]);
+            REQUIRE(plans[0].getTotalCost() == Approx(costs[i]));
+        }
+    }
+
+    SECTION("bestPlan() - a flight that costs nothing does not lead astray")
+    {
+        //the free flight to A2 is tried first, but the best route from A2
+        //is back through A0
+        FlightData free;
+        free.addRoundTrip("A2", "CityA0", 0.0, 10);
+        free.addRoundTrip("CityA0", "A1", 3.9, 10);
+        free.addRoundTrip("A2", "Ozark", 100, 10);
+        free.addRoundTrip("Ozark", "A1", 16.2, 10);
+        FlightGraph freeGraph(free);
+        PathFinder freeFinder(freeGraph);
+
+        Vector<Plan> plans{freeFinder.bestPlan(Request("CityA0", "A1", false)).getPlans()};
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getConnections() == " -> ");
+        REQUIRE(plans[0].getTotalCost() == Approx(3.9));
+
+        plans = freeFinder.topPlans(Request("CityA0", "A1", false), 1).getPlans();
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getConnections() == " -> ");
+
+        plans = freeFinder.topPlans(Request("CityA0", "A1", false), 3).getPlans();
+        REQUIRE(plans.length() == 2);
+        REQUIRE(plans[0].getTotalCost() == Approx(3.9));
+        REQUIRE(plans[1].getTotalCost() == Approx(116.2));
+    }
+
+    SECTION("bestPlan() - ties over flights that cost nothing go to backtracking's first")
+    {
+        //both plans cost 3.90, and backtracking tries the free flight first
+        std::ofstream dataFile("zeroweight_data.txt");
+        dataFile << "3\nCityA0|CityX1|0.00|10\nCityA0|A1|3.90|10\nCityX1|A1|3.90|10\n";
+        dataFile.close();
+        std::ofstream requestFile("zeroweight_requests.txt");
+        requestFile << "2\nCityA0|A1|C\nCityX1|A1|C\n";
+        requestFile.close();
+
+        char data[] = "zeroweight_data.txt";
+        char requests[] = "zeroweight_requests.txt";
+        std::string best{planWith(data, requests, SearchMode::BACKTRACK, 1)};
+        REQUIRE(best.find("Path 1: CityA0 -> CityX1 -> A1.") != std::string::npos);
+        REQUIRE(best.find("Path 1: CityX1 -> CityA0 -> A1.") != std::string::npos);
+        REQUIRE(planWith(data, requests, SearchMode::DIJKSTRA, 1) == best);
+        REQUIRE(planWith(data, requests, SearchMode::K_SHORTEST, 1) == best);
+
+        FlightData free(data);
+        FlightGraph freeGraph(free);
+        PathFinder freeFinder(freeGraph);
+        Vector<Plan> plans{freeFinder.bestPlan(Request("CityA0", "A1", false)).getPlans()};
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getConnections() == " -> CityX1 -> ");
+        remove(data);
+        remove(requests);
+    }
+
+    SECTION("topPlans() - a flight that costs nothing to a dead end is passed by")
+    {
+        //the free flight from B1 to C2 is tried first, and the only way on
+        //from C2 is back through B1
+        FlightData free;
+        free.addRoundTrip("CityA0", "CityB1", 0.2, 10);
+        free.addRoundTrip("CityB1", "CityC2", 0.0, 10);
+        free.addRoundTrip("CityB1", "CityD3", 0.2, 10);
+        free.addRoundTrip("CityA0", "CityD3", 0.9, 10);
+        FlightGraph freeGraph(free);
+        PathFinder freeFinder(freeGraph);
+
+        Vector<Plan> plans{freeFinder.topPlans(Request("CityA0", "CityD3", false), 3).getPlans()};
+        REQUIRE(plans.length() == 2);
+        REQUIRE(plans[0].getConnections() == " -> CityB1 -> ");
+        REQUIRE(plans[0].getTotalCost() == Approx(0.4));
+        REQUIRE(plans[1].getTotalCost() == Approx(0.9));
+
+        plans = freeFinder.bestPlan(Request("CityA0", "CityD3", false)).getPlans();
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getTotalCost() == Approx(0.4));
+    }
+
+    SECTION("flights that weigh nothing - K_SHORTEST prints what backtracking prints")
+    {
+        //plans that tie are listed in the order backtracking finds them
+        char data[] = "zeroweight_data.txt";
+        char requests[] = "zeroweight_requests.txt";
+        for(unsigned int seed{1}; seed <= 40; seed++)
+        {
+            writeZeroWeightFiles(data, requests, 6, 10, seed);
+            REQUIRE(planWith(data, requests, SearchMode::K_SHORTEST, 3) ==
+                    planWith(data, requests, SearchMode::BACKTRACK, 3));
+        }
+        remove(data);
+        remove(requests);
+    }
+
+    SECTION("flights that weigh nothing - grouped DIJKSTRA requests print what backtracking prints")
+    {
+        //the requests to each destination share one tree, read off from
+        //every origin in turn
+        char data[] = "zeroweight_data.txt";
+        char requests[] = "zeroweight_requests.txt";
+        for(unsigned int seed{1}; seed <= 40; seed++)
+        {
+            writeZeroWeightFiles(data, requests, 6, 10, seed);
+            REQUIRE(planWith(data, requests, SearchMode::DIJKSTRA, 1) ==
+                    planWith(data, requests, SearchMode::BACKTRACK, 1));
+        }
+        remove(data);
+        remove(requests);
+    }
+
+    SECTION("flights that weigh nothing - ALL_PAIRS prints what backtracking prints")
+    {
+        char data[] = "zeroweight_data.txt";
+        char requests[] = "zeroweight_requests.txt";
+        for(unsigned int seed{1}; seed <= 40; seed++)
+        {
+            writeZeroWeightFiles(data, requests, 6, 10, seed);
+            REQUIRE(planWith(data, requests, SearchMode::ALL_PAIRS, 1) ==
+                    planWith(data, requests, SearchMode::BACKTRACK, 1));
+        }
+        remove(data);
+        remove(requests);
+    }
+}
+
+TEST_CASE("PathStack", "[PathStack]")
+{
+    FlightData data;
+    data.addRoundTrip("Sandgap", "Madison Park", 282, 322);
+    data.addRoundTrip("Sandgap", "Jamesville", 43, 50);
+    data.addRoundTrip("Madison Park", "Jamesville", 27, 79);
+
+    FlightGraph graph(data);
+    PathStack path(graph);
+    int sandgap = graph.findCity("Sandgap");
+    path.start(sandgap);
+
+    SECTION("nextFlight() - each flight of the top city is given once")
+    {
+        int first = path.nextFlight();
+        int second = path.nextFlight();
+        REQUIRE(graph.getName(graph.getTarget(first)) == "Madison Park");
+        REQUIRE(graph.getName(graph.getTarget(second)) == "Jamesville");
+        REQUIRE(path.nextFlight() == -1);
+    }
+
+    SECTION("push() and pop() - totals are kept for each level")
+    {
+        path.push(path.nextFlight());
+        path.nextFlight();
+        path.push(path.nextFlight());
+        REQUIRE(path.getDepth() == 3);
+        REQUIRE(path.getName(2) == "Jamesville");
+        REQUIRE(path.getCost() == 309);
+        REQUIRE(path.getDuration() == 401);
+
+        path.pop();
+        REQUIRE(path.peek() == graph.findCity("Madison Park"));
+        REQUIRE(path.getCost() == 282);
+
+        path.pop();
+        path.pop();
+        REQUIRE(path.isEmpty());
+        REQUIRE_THROWS_AS(path.pop(), std::out_of_range);
+    }
+
+    SECTION("contains() - cities are marked until they are popped")
+    {
+        int jamesville = graph.findCity("Jamesville");
+        REQUIRE(path.contains(sandgap));
+        REQUIRE_FALSE(path.contains(jamesville));
+
+        path.nextFlight();
+        path.push(path.nextFlight());
+        REQUIRE(path.contains(jamesville));
+
+        path.pop();
+        REQUIRE_FALSE(path.contains(jamesville));
+
+        //starting again clears the marks of the unfinished path
+        path.push(graph.firstFlight(sandgap) + 1);
+        path.start(graph.findCity("Madison Park"));
+        REQUIRE_FALSE(path.contains(sandgap));
+        REQUIRE_FALSE(path.contains(jamesville));
+    }
+
+    SECTION("Plan(path, flight) - the plan is made from the path")
+    {
+        path.nextFlight();
+        path.push(path.nextFlight());
+        int flight = path.nextFlight();
+        while(graph.getName(graph.getTarget(flight)) != "Madison Park")
+            flight = path.nextFlight();
+
+        Plan plan(path, flight);
+        REQUIRE(plan.getOrigin() == "Sandgap");
+        REQUIRE(plan.getConnections() == " -> Jamesville -> ");
+        REQUIRE(plan.getDestination() == "Madison Park");
+        REQUIRE(plan.getTotalCost() == 70);
+        REQUIRE(plan.getTotalDuration() == 129);
+    }
+}
+
+TEST_CASE("Landmarks", "[Landmarks]")
+{
+    FlightData data;
+    data.addRoundTrip("Sandgap", "Madison Park", 282, 322);
+    data.addRoundTrip("Sandgap", "Jamesville", 43, 50);
+    data.addRoundTrip("Madison Park", "Jamesville", 27, 79);
+    data.addRoundTrip("Jamesville", "Pine Bluff", 10, 30);
+
+    FlightGraph graph(data);
+    Landmarks landmarks;
+    landmarks.build(graph, 2);
+
+    SECTION("lowerBound() - never more than the distance between cities")
+    {
+        REQUIRE(landmarks.size() == 2);
+        int sandgap = graph.findCity("Sandgap");
+        int madison = graph.findCity("Madison Park");
+        int pine = graph.findCity("Pine Bluff");
+
+        REQUIRE(landmarks.lowerBound(sandgap, madison, true) <= 129);
+        REQUIRE(landmarks.lowerBound(sandgap, madison, false) <= 7000);
+        REQUIRE(landmarks.lowerBound(pine, madison, true) <= 109);
+        REQUIRE(landmarks.lowerBound(pine, pine, true) == 0);
+        REQUIRE(Landmarks().lowerBound(sandgap, madison, true) == 0);
+    }
+
+    SECTION("aStarPlan() - finds the best plan")
+    {
+        PathFinder finder(graph);
+        Vector<Plan> plans{finder.aStarPlan(
+                        Request("Pine Bluff", "Madison Park", true),
+                        landmarks).getPlans()};
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getConnections() == " -> Jamesville -> ");
+        REQUIRE(plans[0].getTotalDuration() == 109);
+        REQUIRE(plans[0].getTotalCost() == 37);
+
+        REQUIRE(finder.aStarPlan(Request("Sandgap", "Nowhere", true),
+                                 landmarks).getPlans().length() == 0);
+    }
+
+    SECTION("save() and load() - tables are only loaded for the same graph")
+    {
+        REQUIRE(landmarks.save("landmarks_test.bin", graph));
+
+        Landmarks loaded;
+        REQUIRE(loaded.load("landmarks_test.bin", graph));
+        REQUIRE(loaded.size() == 2);
+        REQUIRE(loaded.getLandmark(1) == landmarks.getLandmark(1));
+        for(int c{}; c < graph.getNumCities(); c++)
+        {
+            REQUIRE(loaded.lowerBound(c, 0, true) == landmarks.lowerBound(c, 0, true));
+            REQUIRE(loaded.lowerBound(c, 0, false) == landmarks.lowerBound(c, 0, false));
+        }
+
+        data.addRoundTrip("Pine Bluff", "Sandgap", 5, 5);
+        FlightGraph changed(data);
+        REQUIRE_FALSE(loaded.load("landmarks_test.bin", changed));
+        REQUIRE(loaded.size() == 0);
+        REQUIRE_FALSE(loaded.load("landmarks_missing.bin", graph));
+
+        remove("landmarks_test.bin");
+    }
+
+    SECTION("Output - tables are only saved when a landmark file is given")
+    {
+        std::ofstream dataFile("landmarks_data.txt");
+        dataFile << "4\nSandgap|Madison Park|282|322\nSandgap|Jamesville|43|50\n"
+                 << "Madison Park|Jamesville|27|79\nJamesville|Pine Bluff|10|30\n";
+        dataFile.close();
+        std::ofstream requestFile("landmarks_requests.txt");
+        requestFile << "2\nPine Bluff|Madison Park|T\nSandgap|Madison Park|C\n";
+        requestFile.close();
+
+        char dataName[] = "landmarks_data.txt";
+        char requestName[] = "landmarks_requests.txt";
+        char outputName[] = "landmarks_output.txt";
+        {
+            Output o(dataName, requestName, outputName, SearchMode::ASTAR, 1, 1);
+            o.print();
+        }
+        REQUIRE_FALSE(std::ifstream("landmarks_data.txt.landmarks").is_open());
+
+        //the first run saves the tables, and the second loads them
+        FlightData schedule(dataName);
+        FlightGraph scheduleGraph(schedule);
+        for(int run{}; run < 2; run++)
+        {
+            Output o(dataName, requestName, outputName, SearchMode::ASTAR, 1, 1,
+                     false, WriteMode::BUFFERED, "landmarks_kept.bin");
+            o.print();
+            Landmarks kept;
+            REQUIRE(kept.load("landmarks_kept.bin", scheduleGraph));
+        }
+
+        std::ifstream output(outputName);
+        std::string text{std::istreambuf_iterator<char>(output),
+                         std::istreambuf_iterator<char>()};
+        REQUIRE(text.find("Time: 109") != std::string::npos);
+        REQUIRE(text.find("Cost: 70.00") != std::string::npos);
+
+        remove("landmarks_data.txt");
+        remove("landmarks_requests.txt");
+        remove("landmarks_output.txt");
+        remove("landmarks_kept.bin");
+    }
+}
+
+TEST_CASE("ContractionHierarchy", "[ContractionHierarchy]")
+{
+    FlightData data;
+    data.addRoundTrip("Sandgap", "Madison Park", 282, 322);
+    data.addRoundTrip("Sandgap", "Jamesville", 43, 50);
+    data.addRoundTrip("Madison Park", "Jamesville", 27, 79);
+    data.addRoundTrip("Jamesville", "Pine Bluff", 10, 30);
+    data.addRoundTrip("Pine Bluff", "Ozark", 12, 15);
+    data.addRoundTrip("Ozark", "Sandgap", 90, 20);
+
+    FlightGraph graph(data);
+    PathFinder finder(graph);
+    ContractionHierarchy byTime;
+    ContractionHierarchy byCost;
+    byTime.build(graph, true);
+    byCost.build(graph, false);
+
+    SECTION("build() - every city is given its own rank")
+    {
+        bool* used = new bool[graph.getNumCities()]{};
+        for(int c{}; c < graph.getNumCities(); c++)
+        {
+            REQUIRE(byTime.getRank(c) >= 0);
+            REQUIRE(byTime.getRank(c) < graph.getNumCities());
+            REQUIRE_FALSE(used[byTime.getRank(c)]);
+            used[byTime.getRank(c)] = true;
+        }
+        delete[] used;
+    }
+
+    SECTION("hierarchyPlan() - same totals as bestPlan() for every pair")
+    {
+        const char* names[] = {"Sandgap", "Madison Park", "Jamesville",
+                               "Pine Bluff", "Ozark"};
+        for(int tag{}; tag < 2; tag++)
+        {
+            for(const char* orig : names)
+            {
+                for(const char* dest : names)
+                {
+                    Request r(orig, dest, tag == 1);
+                    Vector<Plan> best{finder.bestPlan(r).getPlans()};
+                    Vector<Plan> found{finder.hierarchyPlan(r,
+                                        (tag == 1) ? byTime : byCost).getPlans()};
+                    REQUIRE(found.length() == best.length());
+                    if(tag == 1)
+                        REQUIRE(found[0].getTotalDuration() == best[0].getTotalDuration());
+                    else
+                        REQUIRE(found[0].getTotalCost() == Approx(best[0].getTotalCost()));
+                }
+            }
+        }
+    }
+
+    SECTION("hierarchyPlan() - shortcuts are unpacked into every connection")
+    {
+        Vector<Plan> plans{finder.hierarchyPlan(
+                        Request("Madison Park", "Ozark", false), byCost).getPlans()};
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getConnections() == " -> Jamesville -> Pine Bluff -> ");
+        REQUIRE(plans[0].getTotalCost() == 49);
+        REQUIRE(plans[0].getTotalDuration() == 124);
+    }
+
+    SECTION("hierarchyPlan() - the hierarchy must match the metric")
+    {
+        REQUIRE_THROWS_AS(finder.hierarchyPlan(
+                        Request("Sandgap", "Ozark", true), byCost),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(finder.hierarchyPlan(
+                        Request("Sandgap", "Ozark", true), ContractionHierarchy()),
+                          std::invalid_argument);
+    }
+}
+
+//Fills a schedule with round trips from each city to random others, so
+//that each city has about the given number of destinations
+void addRandomFlights(FlightData& data, int numCities, int degree, unsigned int seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> city(0, numCities - 1);
+    std::uniform_int_distribution<int> cents(2000, 60000);
+    std::uniform_int_distribution<int> minutes(30, 600);
+
+    for(int i{}; i < numCities; i++)
+    {
+        for(int d{}; d < degree / 2; d++)
+        {
+            int other = city(random);
+            if(other != i)
+                data.addRoundTrip(std::to_string(i).c_str(), std::to_string(other).c_str(),
+                                  cents(random) / 100.0, minutes(random));
+        }
+    }
+}
+
+TEST_CASE("AllPairs", "[AllPairs]")
+{
+    FlightData data;
+    data.addRoundTrip("Sandgap", "Madison Park", 282, 322);
+    data.addRoundTrip("Sandgap", "Jamesville", 43, 50);
+    data.addRoundTrip("Madison Park", "Jamesville", 27, 79);
+    data.addRoundTrip("Jamesville", "Pine Bluff", 10, 30);
+    data.addRoundTrip("Pine Bluff", "Ozark", 12, 15);
+    data.addRoundTrip("Ozark", "Sandgap", 90, 20);
+    data.addRoundTrip("Hollister", "Branson", 5, 10);
+
+    FlightGraph graph(data);
+    PathFinder finder(graph);
+    ThreadPool pool(2);
+    AllPairs byTime;
+    AllPairs byCost;
+    byTime.build(graph, true, pool);
+    byCost.build(graph, false, pool);
+
+    SECTION("build() - distances are symmetric and zero to the same city")
+    {
+        for(int a{}; a < graph.getNumCities(); a++)
+        {
+            REQUIRE(byTime.getDistance(a, a) == 0);
+            REQUIRE(byTime.getNextFlight(a, a) == -1);
+            for(int b{}; b < graph.getNumCities(); b++)
+                REQUIRE(byTime.getDistance(a, b) == byTime.getDistance(b, a));
+        }
+        int sandgap = graph.findCity("Sandgap");
+        int branson = graph.findCity("Branson");
+        REQUIRE(byCost.getDistance(sandgap, branson) == AllPairs::UNREACHABLE);
+        REQUIRE(byCost.getNextFlight(sandgap, branson) == -1);
+    }
+
+    SECTION("allPairsPlan() - same plan as bestPlan() for every pair")
+    {
+        const char* names[] = {"Sandgap", "Madison Park", "Jamesville",
+                               "Pine Bluff", "Ozark", "Branson"};
+        for(int tag{}; tag < 2; tag++)
+        {
+            for(const char* orig : names)
+            {
+                for(const char* dest : names)
+                {
+                    Request r(orig, dest, tag == 1);
+                    Vector<Plan> best{finder.bestPlan(r).getPlans()};
+                    Vector<Plan> found{finder.allPairsPlan(r,
+                                        (tag == 1) ? byTime : byCost).getPlans()};
+                    REQUIRE(found.length() == best.length());
+                    if(found.length() > 0)
+                    {
+                        REQUIRE(found[0].getConnections() == best[0].getConnections());
+                        REQUIRE(found[0].getTotalDuration() == best[0].getTotalDuration());
+                        REQUIRE(found[0].getTotalCost() == Approx(best[0].getTotalCost()));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("build() - more cities than fit within one tile")
+    {
+        //a line of cities, each a dollar and a minute from the last
+        FlightData line;
+        int numCities = AllPairs::TILE * 2 + 5;
+        for(int i{1}; i < numCities; i++)
+            line.addRoundTrip(std::to_string(i - 1).c_str(),
+                              std::to_string(i).c_str(), 1, 1);
+        FlightGraph lineGraph(line);
+        AllPairs table;
+        table.build(lineGraph, false, pool);
+
+        int first = lineGraph.findCity("0");
+        int last = lineGraph.findCity(std::to_string(numCities - 1).c_str());
+        REQUIRE(table.getDistance(first, last) == (numCities - 1) * 100);
+
+        Route route(lineGraph, numCities, false);
+        REQUIRE(table.findRoute(first, last, route));
+        REQUIRE(route.getLength() == numCities - 1);
+        REQUIRE(route.getDistance() == (numCities - 1) * 100);
+    }
+
+    SECTION("build() - every kernel the processor has gives the same tables")
+    {
+        FlightData dense;
+        addRandomFlights(dense, AllPairs::TILE * 3 - 10, 16, 2341);
+        FlightGraph denseGraph(dense);
+
+        for(int tag{}; tag < 2; tag++)
+        {
+            AllPairs scalar;
+            REQUIRE(scalar.setKernel(AllPairs::Kernel::SCALAR));
+            scalar.build(denseGraph, tag == 1, pool);
+
+            AllPairs::Kernel kernels[] = {AllPairs::Kernel::SSE4, AllPairs::Kernel::AVX2};
+            for(AllPairs::Kernel kernel : kernels)
+            {
+                AllPairs table;
+                if(!table.setKernel(kernel))
+                    continue;
+                table.build(denseGraph, tag == 1, pool);
+                int differences{0};
+                for(int a{}; a < denseGraph.getNumCities(); a++)
+                {
+                    for(int b{}; b < denseGraph.getNumCities(); b++)
+                    {
+                        if(table.getDistance(a, b) != scalar.getDistance(a, b) ||
+                                table.getNextFlight(a, b) != scalar.getNextFlight(a, b))
+                            differences++;
+                    }
+                }
+                REQUIRE(differences == 0);
+            }
+        }
+        REQUIRE(AllPairs::isSupported(AllPairs::Kernel::SCALAR));
+        REQUIRE(AllPairs::isSupported(AllPairs::fastestKernel()));
+    }
+
+    SECTION("findRoute() - flights that cost nothing do not loop")
+    {
+        //the free flight to A2 comes first, and is as good as any other
+        //first flight from CityA0 to A1
+        FlightData free;
+        free.addRoundTrip("A2", "CityA0", 0.0, 10);
+        free.addRoundTrip("CityA0", "A1", 3.9, 10);
+        free.addRoundTrip("A2", "Ozark", 100, 10);
+        free.addRoundTrip("Ozark", "A1", 16.2, 10);
+        free.addRoundTrip("CityA0", "CityB1", 0.0, 10);
+        free.addRoundTrip("CityA0", "CityX1", 0.0, 10);
+        free.addRoundTrip("CityX1", "A1", 3.9, 10);
+        FlightGraph freeGraph(free);
+        PathFinder freeFinder(freeGraph);
+        AllPairs table;
+        table.build(freeGraph, false, pool);
+
+        for(int a{}; a < freeGraph.getNumCities(); a++)
+        {
+            for(int b{}; b < freeGraph.getNumCities(); b++)
+            {
+                if(a == b)
+                    continue;
+                Route route(freeGraph, freeGraph.getNumCities(), false);
+                REQUIRE_NOTHROW(table.findRoute(a, b, route));
+                REQUIRE(route.getDistance() == table.getDistance(a, b));
+            }
+        }
+
+        Vector<Plan> plans{freeFinder.allPairsPlan(
+                        Request("CityA0", "A1", false), table).getPlans()};
+        REQUIRE(plans.length() == 1);
+        REQUIRE(plans[0].getConnections() == " -> ");
+        REQUIRE(plans[0].getTotalCost() == Approx(3.9));
+
+        plans = freeFinder.allPairsPlan(Request("A2", "A1", false), table).getPlans();
+        REQUIRE(plans[0].getConnections() == " -> CityA0 -> ");
+
+        //the free flight back to CityA0 comes first, and ties with A1
+        plans = freeFinder.allPairsPlan(Request("CityX1", "A1", false), table).getPlans();
+        REQUIRE(plans[0].getConnections() == " -> CityA0 -> ");
+
+        const char* names[] = {"A2", "CityA0", "A1", "Ozark", "CityB1", "CityX1"};
+        for(const char* orig : names)
+        {
+            for(const char* dest : names)
+            {
+                Request r(orig, dest, false);
+                Vector<Plan> best{freeFinder.bestPlan(r).getPlans()};
+                Vector<Plan> found{freeFinder.allPairsPlan(r, table).getPlans()};
+                REQUIRE(found.length() == best.length());
+                if(found.length() > 0)
+                    REQUIRE(found[0].getConnections() == best[0].getConnections());
+            }
+        }
+    }
+
+    SECTION("allPairsPlan() - the tables must match the metric")
+    {
+        REQUIRE_THROWS_AS(finder.allPairsPlan(
+                        Request("Sandgap", "Ozark", true), byCost),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(finder.allPairsPlan(
+                        Request("Sandgap", "Ozark", true), AllPairs()),
+                          std::invalid_argument);
+    }
+}
+
+//Hidden, since it takes a while: run with "[AllPairsKernels]" to compare
+//the time each kernel takes to build the tables of random schedules
+TEST_CASE("AllPairs kernels", "[.][AllPairsKernels]")
+{
+    const char* names[] = {"scalar", "SSE4.1", "AVX2"};
+    AllPairs::Kernel kernels[] = {AllPairs::Kernel::SCALAR, AllPairs::Kernel::SSE4,
+                                  AllPairs::Kernel::AVX2};
+    int sizes[] = {512, 1024, 2048};
+    ThreadPool pool(1);
+
+    for(int numCities : sizes)
+    {
+        FlightData data;
+        addRandomFlights(data, numCities, 32, numCities);
+        FlightGraph graph(data);
+
+        double scalarTime{0};
+        for(int i{}; i < 3; i++)
+        {
+            AllPairs table;
+            if(!table.setKernel(kernels[i]))
+            {
+                std::cout << numCities << " cities, " << names[i] << ": not supported\n";
+                continue;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            table.build(graph, false, pool);
+            std::chrono::duration<double> took{std::chrono::steady_clock::now() - start};
+            if(i == 0)
+                scalarTime = took.count();
+
+            std::cout << numCities << " cities, " << names[i] << ": " << took.count()
+                      << "s (" << scalarTime / took.count() << "x scalar)\n";
+        }
+    }
+}
+
+TEST_CASE("PlanCache", "[PlanCache]")
+{
+    Vector<Plan> first{};
+    first.pushBack(Plan("Sandgap", "Jamesville"));
+    Vector<Plan> second{};
+    second.pushBack(Plan("Sandgap", "Ozark"));
+    second.pushBack(Plan("Sandgap", "Ozark"));
+
+    long long byTime{PlanCache::makeKey(0, 2, true)};
+    long long byCost{PlanCache::makeKey(0, 2, false)};
+    long long other{PlanCache::makeKey(0, 4, true)};
+
+    SECTION("makeKey() - keys differ by each city and by the metric")
+    {
+        REQUIRE(byTime != byCost);
+        REQUIRE(byTime != other);
+        REQUIRE(PlanCache::makeKey(2, 0, true) != byTime);
+    }
+
+    SECTION("find() - only keys that were inserted are found")
+    {
+        PlanCache cache(4);
+        Vector<Plan> found{};
+        REQUIRE_FALSE(cache.find(byTime, found));
+
+        cache.insert(byTime, first);
+        cache.insert(other, second);
+        REQUIRE(cache.find(byTime, found));
+        REQUIRE(found.length() == 1);
+        REQUIRE(cache.find(other, found));
+        REQUIRE(found.length() == 2);
+        REQUIRE_FALSE(cache.find(byCost, found));
+
+        REQUIRE(cache.size() == 2);
+        REQUIRE(cache.getHits() == 2);
+        REQUIRE(cache.getMisses() == 2);
+    }
+
+    SECTION("insert() - the least recently used entry is replaced")
+    {
+        PlanCache cache(2);
+        Vector<Plan> found{};
+        cache.insert(byTime, first);
+        cache.insert(byCost, first);
+
+        //using byTime leaves byCost as the oldest entry
+        REQUIRE(cache.find(byTime, found));
+        cache.insert(other, second);
+
+        REQUIRE(cache.size() == 2);
+        REQUIRE(cache.find(byTime, found));
+        REQUIRE(cache.find(other, found));
+        REQUIRE_FALSE(cache.find(byCost, found));
+    }
+
+    SECTION("insert() - many keys through a small cache")
+    {
+        PlanCache cache(8);
+        Vector<Plan> found{};
+        for(int i{}; i < 100; i++)
+            cache.insert(PlanCache::makeKey(i, i + 1, false), first);
+
+        REQUIRE(cache.size() == 8);
+        for(int i{}; i < 100; i++)
+            REQUIRE(cache.find(PlanCache::makeKey(i, i + 1, false), found) == (i >= 92));
+    }
+
+    SECTION("clear() - no entries and no counts are left")
+    {
+        PlanCache cache(4);
+        Vector<Plan> found{};
+        cache.insert(byTime, first);
+        cache.find(byTime, found);
+        cache.clear();
+
+        REQUIRE(cache.size() == 0);
+        REQUIRE(cache.getHits() == 0);
+        REQUIRE_FALSE(cache.find(byTime, found));
+    }
+
+    SECTION("a cache of no entries never holds anything")
+    {
+        PlanCache cache(0);
+        Vector<Plan> found{};
+        cache.insert(byTime, first);
+        REQUIRE_FALSE(cache.find(byTime, found));
+        REQUIRE(cache.size() == 0);
+    }
+
+    SECTION("Output - repeated requests are served from the cache")
+    {
+        std::ofstream dataFile("plancache_data.txt");
+        dataFile << "3\nSandgap|Madison Park|282|322\nSandgap|Jamesville|43|50\n"
+                 << "Madison Park|Jamesville|27|79\n";
+        dataFile.close();
+        std::ofstream requestFile("plancache_requests.txt");
+        requestFile << "4\nSandgap|Madison Park|C\nSandgap|Madison Park|T\n"
+                    << "Sandgap|Madison Park|C\nJamesville|Sandgap|T\n";
+        requestFile.close();
+
+        char data[] = "plancache_data.txt";
+        char requests[] = "plancache_requests.txt";
+        char output[] = "plancache_output.txt";
+
+        //every journey is found once for both metrics, by one walk from
+        //each origin, and each destination is looked up once per walk
+        Output backtracking(data, requests, output, SearchMode::BACKTRACK, 3, 1);
+        REQUIRE(backtracking.getCache().getMisses() == 2);
+        REQUIRE(backtracking.getCache().getHits() == 0);
+        backtracking.retrieveFlights();
+        REQUIRE(backtracking.getCache().getMisses() == 2);
+        REQUIRE(backtracking.getCache().getHits() == 2);
+
+        //while the single best plan depends on the metric
+        Output dijkstra(data, requests, output, SearchMode::DIJKSTRA, 3, 1);
+        REQUIRE(dijkstra.getCache().getMisses() == 3);
+        REQUIRE(dijkstra.getCache().getHits() == 1);
+
+        remove("plancache_data.txt");
+        remove("plancache_requests.txt");
+        remove("plancache_output.txt");
+    }
+}
+
+TEST_CASE("Output streaming", "[OutputStreaming]")
+{
+    SECTION("print() - streaming writes the same blocks as solving first")
+    {
+        std::ofstream dataFile("outputstreaming_data.txt");
+        dataFile << "3\nSandgap|Madison Park|282|322\nSandgap|Jamesville|43|50\n"
+                 << "Madison Park|Jamesville|27|79\n";
+        dataFile.close();
+
+        //more requests than the window, so the window is reused
+        std::ofstream requestFile("outputstreaming_requests.txt");
+        requestFile << "600\n";
+        for(int i{}; i < 200; i++)
+            requestFile << "Sandgap|Jamesville|C\nJamesville|Sandgap|T\n"
+                        << "Sandgap|Nowhere|T\n";
+        requestFile.close();
+
+        char data[] = "outputstreaming_data.txt";
+        char requests[] = "outputstreaming_requests.txt";
+        char solvedOutput[] = "outputstreaming_solved.out";
+        char streamedOutput[] = "outputstreaming_streamed.out";
+        SearchMode modes[] = {SearchMode::BACKTRACK, SearchMode::K_SHORTEST};
+        for(SearchMode mode : modes)
+        {
+            {
+                Output solved(data, requests, solvedOutput, mode, 3, 2);
+                solved.print();
+                Output streamed(data, requests, streamedOutput, mode, 3, 4, true);
+                streamed.print();
+            }
+
+            std::ifstream first(solvedOutput), second(streamedOutput);
+            std::string expected{std::istreambuf_iterator<char>(first),
+                                 std::istreambuf_iterator<char>()};
+            std::string actual{std::istreambuf_iterator<char>(second),
+                               std::istreambuf_iterator<char>()};
+            REQUIRE_FALSE(expected.empty());
+            REQUIRE(actual == expected);
+        }
+
+        remove("outputstreaming_data.txt");
+        remove("outputstreaming_requests.txt");
+        remove("outputstreaming_solved.out");
+        remove("outputstreaming_streamed.out");
+    }
+}
+
+TEST_CASE("NetworkGenerator", "[NetworkGenerator]")
+{
+    Topology topologies[] = {Topology::GEOMETRIC, Topology::HUB_AND_SPOKE,
+                             Topology::GRID};
+
+    SECTION("writeSchedule() - the schedule parses with every leg both ways")
+    {
+        for(Topology topology : topologies)
+        {
+            NetworkGenerator network(topology, 200, 600);
+            REQUIRE(network.getNumCities() == 200);
+            REQUIRE(network.getNumLegs() == 600);
+            REQUIRE(network.writeSchedule("networkgenerator_data.txt"));
+
+            char fileName[] = "networkgenerator_data.txt";
+            FlightData data(fileName);
+            FlightGraph graph(data);
+            REQUIRE(graph.getNumFlights() == 1200);
+            REQUIRE(graph.getNumCities() <= 200);
+            REQUIRE(graph.findCity(NetworkGenerator::cityName(0).c_str()) != -1);
+        }
+    }
+
+    SECTION("the same seed gives the same network")
+    {
+        NetworkGenerator first(Topology::HUB_AND_SPOKE, 50, 120, 7);
+        NetworkGenerator second(Topology::HUB_AND_SPOKE, 50, 120, 7);
+        REQUIRE(first.writeSchedule("networkgenerator_data.txt"));
+        REQUIRE(second.writeSchedule("networkgenerator_copy.txt"));
+
+        std::ifstream a("networkgenerator_data.txt"), b("networkgenerator_copy.txt");
+        std::string left{std::istreambuf_iterator<char>(a), std::istreambuf_iterator<char>()};
+        std::string right{std::istreambuf_iterator<char>(b), std::istreambuf_iterator<char>()};
+        REQUIRE(left == right);
+        remove("networkgenerator_copy.txt");
+    }
+
+    SECTION("a grid joins every city to its neighbours, and legs are capped")
+    {
+        NetworkGenerator grid(Topology::GRID, 16, 24);
+        REQUIRE(grid.getNumLegs() == 24);
+        NetworkGenerator full(Topology::GEOMETRIC, 10, 1000);
+        REQUIRE(full.getNumLegs() == 45);
+    }
+
+    SECTION("writeRequests() - every request names two cities of the network")
+    {
+        NetworkGenerator network(Topology::GEOMETRIC, 100, 400);
+        REQUIRE(network.writeSchedule("networkgenerator_data.txt"));
+        REQUIRE(network.writeRequests("networkgenerator_requests.txt", 250));
+
+        char dataName[] = "networkgenerator_data.txt";
+        char requestName[] = "networkgenerator_requests.txt";
+        FlightData data(dataName);
+        FlightGraph graph(data);
+        FlightRequests requests(requestName, graph.getCities());
+        const Vector<Request>& reqs{requests.getRequests()};
+        REQUIRE(reqs.length() == 250);
+
+        int byTime{0};
+        for(int i{}; i < reqs.length(); i++)
+        {
+            REQUIRE_FALSE(reqs[i].getOrigin() == reqs[i].getDestination());
+            if(reqs[i].getTimeTag())
+                byTime++;
+        }
+        REQUIRE(byTime > 0);
+        REQUIRE(byTime < 250);
+        remove("networkgenerator_requests.txt");
+    }
+    remove("networkgenerator_data.txt");
+}
+
+//Hidden, since it takes a while: run with "[Benchmark]" to measure each
+//search on a small network of each shape
+TEST_CASE("Benchmark", "[.][Benchmark]")
+{
+    Topology topologies[] = {Topology::GEOMETRIC, Topology::HUB_AND_SPOKE,
+                             Topology::GRID};
+    for(Topology topology : topologies)
+    {
+        Benchmark bench(topology, 1000, 4000, 500);
+        bench.run(std::cout);
+    }
+    REQUIRE(Benchmark::peakMemory() > 0);
+}
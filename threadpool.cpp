@@ -0,0 +1,212 @@
+#include "threadpool.h"
+
+/**
+ * Constructor with int
+ *
+ * @param numThreads - the number of workers, including the calling thread.
+ *                     If 0 or less, one worker is made for each core.
+ */
+ThreadPool::ThreadPool(int numThreads) : numThreads{numThreads},
+    threads{nullptr}, ranges{nullptr}, job{nullptr}, generation{0},
+    running{0}, stopping{false}, error{}
+{
+    if(this->numThreads <= 0)
+        this->numThreads = static_cast<int>(std::thread::hardware_concurrency());
+    if(this->numThreads <= 0)
+        this->numThreads = 1;
+
+    ranges = new Range[this->numThreads];
+    for(int i{}; i < this->numThreads; i++)
+    {
+        ranges[i].next = 0;
+        ranges[i].end = 0;
+    }
+
+    threads = new std::thread[this->numThreads - 1];
+    for(int i{1}; i < this->numThreads; i++)
+        threads[i - 1] = std::thread(&ThreadPool::workerLoop, this, i);
+}
+
+/**
+ * Destructor - stops and joins the worker threads
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    start.notify_all();
+
+    for(int i{}; i < numThreads - 1; i++)
+        threads[i].join();
+
+    delete[] threads;
+    delete[] ranges;
+}
+
+/**
+ * run(numTasks, job)
+ *
+ * Splits the tasks evenly between the workers and wakes them, then works on
+ * the tasks from the calling thread until every worker has finished.
+ *
+ * @param numTasks - the number of tasks to run
+ * @param job - the function run for each task, given the number of the
+ *              worker running it and the number of the task
+ * @exception the first exception thrown by job, once every task has run
+ */
+void ThreadPool::run(int numTasks, const std::function<void(int, int)>& job)
+{
+    for(int i{}; i < numThreads; i++)
+    {
+        std::lock_guard<std::mutex> guard(ranges[i].lock);
+        ranges[i].next = static_cast<int>(static_cast<long long>(numTasks) * i / numThreads);
+        ranges[i].end = static_cast<int>(static_cast<long long>(numTasks) * (i + 1) / numThreads);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        this->job = &job;
+        error = nullptr;
+        running = numThreads - 1;
+        generation++;
+    }
+    start.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> guard(lock);
+    done.wait(guard, [this] { return running == 0; });
+    this->job = nullptr;
+
+    if(error)
+    {
+        std::exception_ptr e{error};
+        error = nullptr;
+        std::rethrow_exception(e);
+    }
+}
+
+/**
+ * size()
+ * @return the number of workers, including the calling thread
+ */
+int ThreadPool::size() const
+{
+    return numThreads;
+}
+
+/**
+ * workerLoop(worker)
+ *
+ * Run by each worker thread. Waits for a batch to be started, works on it,
+ * and reports that it has finished, until the pool is destroyed.
+ *
+ * @param worker - the number of the worker
+ */
+void ThreadPool::workerLoop(int worker)
+{
+    int seen{0};
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            start.wait(guard, [&] { return stopping || generation != seen; });
+            if(stopping)
+                return;
+            seen = generation;
+        }
+
+        work(worker);
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            running--;
+        }
+        done.notify_one();
+    }
+}
+
+/**
+ * work(worker)
+ *
+ * Runs tasks from the range of the worker, then from the ranges of other
+ * workers, until there are none left. Exceptions are kept for run() to
+ * rethrow, so that a failed task does not stop the rest.
+ *
+ * @param worker - the number of the worker
+ */
+void ThreadPool::work(int worker)
+{
+    int task{};
+    while(takeTask(worker, task) || steal(worker, task))
+    {
+        try
+        {
+            (*job)(worker, task);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if(!error)
+                error = std::current_exception();
+        }
+    }
+}
+
+/**
+ * takeTask(worker, task)
+ *
+ * @param worker - the number of the worker
+ * @param task - set to the task taken
+ * @return true if the worker had a task left, false otherwise
+ */
+bool ThreadPool::takeTask(int worker, int& task)
+{
+    Range& range{ranges[worker]};
+    std::lock_guard<std::mutex> guard(range.lock);
+    if(range.next == range.end)
+        return false;
+
+    task = range.next++;
+    return true;
+}
+
+/**
+ * steal(worker, task)
+ *
+ * Looks through the other workers, starting after this one, for a worker
+ * with tasks left, and takes the back half of its range. The first task
+ * taken is returned, and the rest become the range of this worker.
+ *
+ * @param worker - the number of the worker
+ * @param task - set to the first task taken
+ * @return true if a task was taken, false if no worker has any left
+ */
+bool ThreadPool::steal(int worker, int& task)
+{
+    for(int i{1}; i < numThreads; i++)
+    {
+        Range& victim{ranges[(worker + i) % numThreads]};
+        int first{}, last{};
+        {
+            std::lock_guard<std::mutex> guard(victim.lock);
+            int left = victim.end - victim.next;
+            if(left == 0)
+                continue;
+
+            first = victim.end - (left + 1) / 2;
+            last = victim.end;
+            victim.end = first;
+        }
+
+        Range& own{ranges[worker]};
+        std::lock_guard<std::mutex> guard(own.lock);
+        task = first;
+        own.next = first + 1;
+        own.end = last;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,82 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * The ThreadPool class runs a batch of numbered tasks across a fixed set of
+ * worker threads. The calling thread takes part as worker 0, so a pool of
+ * one thread runs every task inline.
+ *
+ * Each batch is split into one contiguous range of tasks per worker. A
+ * worker takes tasks from the front of its own range, and once its range is
+ * empty it steals the back half of the range of another worker, so workers
+ * that are given slow tasks are helped by the rest.
+ *
+ * Tasks are given the number of the worker running them, so that each
+ * worker can keep its own scratch state. If a task throws, the remaining
+ * tasks are still run and the first exception is rethrown by run().
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class ThreadPool
+{
+    private:
+
+        //The range of tasks left to a worker, from next up to end
+        struct Range
+        {
+            std::mutex lock;
+            int next;
+            int end;
+        };
+
+        int numThreads;
+        std::thread* threads;       //workers 1 to numThreads - 1
+        Range* ranges;              //tasks left to each worker
+
+        std::mutex lock;            //guards the fields below
+        std::condition_variable start;
+        std::condition_variable done;
+        const std::function<void(int, int)>* job;
+        int generation;             //number of batches started
+        int running;                //workers still working on the batch
+        bool stopping;
+        std::exception_ptr error;   //first exception thrown by a task
+
+        //Waits for batches and works on them, for workers 1 and up
+        void workerLoop(int worker);
+
+        //Runs tasks until no worker has any left
+        void work(int worker);
+
+        //Takes the next task from the range of the worker
+        bool takeTask(int worker, int& task);
+
+        //Moves half of the range of another worker to this worker
+        bool steal(int worker, int& task);
+
+    public:
+
+        //Constructors and destructor
+        ThreadPool(int numThreads = 0);
+        ThreadPool(const ThreadPool& other) = delete;
+        ThreadPool& operator=(const ThreadPool& other) = delete;
+        ~ThreadPool();
+
+        //Runs job(worker, task) for every task from 0 to numTasks - 1
+        void run(int numTasks, const std::function<void(int, int)>& job);
+
+        //Returns the number of workers, including the calling thread
+        int size() const;
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,526 @@
+#ifndef VECTOR
+#define VECTOR
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * A Vector is a contiguously allocated, growable array. Unlike the
+ * LinkedList, elements are accessed by index in constant time, at the cost
+ * of copying (or moving) every element whenever the array has to grow.
+ *
+ * The array doubles in size when it runs out of room, so pushBack() takes
+ * amortized constant time, and reserve() can be used to allocate the room
+ * for a known number of elements up front. Elements are moved rather than
+ * copied when the array grows, and when the Vector itself is moved.
+ *
+ * Pointers and references to elements are invalidated when the Vector
+ * grows.
+ *
+ * This Vector class will be used in the Sprint4: Flight Planner Project,
+ * in SMU CS2341.
+ *
+ * By: Oisin Coveney
+ * Created:         October 17, 2026
+ * Last Modified:   October 17, 2026
+ */
+template<class T>
+class Vector
+{
+    private:
+
+        T* data;            //array of elements
+        int size;           //number of elements within the vector
+        int capacity;       //number of elements the array can hold
+
+        //Moves the elements into an array of the given capacity
+        void reallocate(int newCapacity);
+
+    public:
+
+        //Rule of 3 + constructors + move operations
+        Vector();
+        Vector(const Vector& other);
+        Vector(Vector&& other) noexcept;
+        Vector& operator=(const Vector& other);
+        Vector& operator=(Vector&& other) noexcept;
+        ~Vector();
+
+        //capacity
+        bool empty() const;
+        int length() const;
+        void reserve(int newCapacity);
+
+        //element access
+        T& front();
+        T& back();
+        T get(int index) const;
+        T& operator[](int index);
+        const T& operator[](int index) const;
+        int find(const T& value) const;
+
+        //modifiers
+        void pushBack(const T& value);
+        void pushBack(T&& value);
+        int uniquePushBack(const T& value);
+        T popBack();
+        void resize(int size, const T& val);
+        void clear();
+
+        //Iterators for range-based for loops
+        T* begin();
+        T* end();
+        const T* begin() const;
+        const T* end() const;
+
+        //Operator<< overload for Vector
+        template<class S>
+        friend std::ostream& operator<<(std::ostream& o, const Vector<S>& vec);
+};
+
+
+//Private functions
+
+/**
+ * reallocate(int newCapacity)
+ *
+ * @param newCapacity : the number of elements the new array will hold, which
+ *                      must be at least the size of the vector
+ */
+template<class T>
+void Vector<T>::reallocate(int newCapacity)
+{
+    T* temp = new T[newCapacity];
+    for(int i{}; i < size; i++)
+        temp[i] = std::move(data[i]);
+
+    delete[] data;
+    data = temp;
+    capacity = newCapacity;
+}
+
+
+//Constructors, Rule of 3, and move operations
+
+/**
+ * Default constructor
+ */
+template<class T>
+Vector<T>::Vector() : data{nullptr}, size{0}, capacity{0} {}
+
+/**
+ * Copy constructor
+ *
+ * @param other : the Vector to copy elements from
+ */
+template<class T>
+Vector<T>::Vector(const Vector& other)
+    : data{nullptr}, size{other.size}, capacity{other.size}
+{
+    if(capacity > 0)
+    {
+        data = new T[capacity];
+        for(int i{}; i < size; i++)
+            data[i] = other.data[i];
+    }
+}
+
+/**
+ * Move constructor
+ *
+ * Takes the array of the other Vector, leaving it empty.
+ *
+ * @param other : the Vector to move elements from
+ */
+template<class T>
+Vector<T>::Vector(Vector&& other) noexcept
+    : data{other.data}, size{other.size}, capacity{other.capacity}
+{
+    other.data = nullptr;
+    other.size = 0;
+    other.capacity = 0;
+}
+
+/**
+ * Copy assignment operator
+ *
+ * The array is only reallocated if it cannot hold the elements of other.
+ *
+ * @param other : the Vector to copy elements from
+ * @return a reference to this Vector, containing the elements of other
+ */
+template<class T>
+Vector<T>& Vector<T>::operator=(const Vector& other)
+{
+    if(this != &other)
+    {
+        if(capacity < other.size)
+        {
+            delete[] data;
+            data = new T[other.size];
+            capacity = other.size;
+        }
+        size = other.size;
+        for(int i{}; i < size; i++)
+            data[i] = other.data[i];
+    }
+    return *this;
+}
+
+/**
+ * Move assignment operator
+ *
+ * @param other : the Vector to move elements from, which is left empty
+ * @return a reference to this Vector, containing the elements of other
+ */
+template<class T>
+Vector<T>& Vector<T>::operator=(Vector&& other) noexcept
+{
+    if(this != &other)
+    {
+        delete[] data;
+        data = other.data;
+        size = other.size;
+        capacity = other.capacity;
+
+        other.data = nullptr;
+        other.size = 0;
+        other.capacity = 0;
+    }
+    return *this;
+}
+
+/**
+ * Destructor
+ */
+template<class T>
+Vector<T>::~Vector()
+{
+    delete[] data;
+}
+
+
+//Capacity
+
+/**
+ * empty()
+ *
+ * @return true if the vector has no elements, false if not
+ */
+template<class T>
+bool Vector<T>::empty() const
+{
+    return size == 0;
+}
+
+/**
+ * length()
+ *
+ * @return the number of elements within the vector
+ */
+template<class T>
+int Vector<T>::length() const
+{
+    return size;
+}
+
+/**
+ * reserve(int newCapacity)
+ *
+ * Grows the array so that it can hold at least newCapacity elements without
+ * being reallocated. The array is never shrunk.
+ *
+ * @param newCapacity : the number of elements to make room for
+ */
+template<class T>
+void Vector<T>::reserve(int newCapacity)
+{
+    if(newCapacity > capacity)
+        reallocate(newCapacity);
+}
+
+
+//Accessor functions
+
+/**
+ * front()
+ *
+ * @return a reference to the first element of the vector
+ * @exception out_of_range if there are no elements in the vector
+ */
+template<class T>
+T& Vector<T>::front()
+{
+    if(size == 0)
+        throw std::out_of_range("Vector<T>::front() - vector is empty");
+    return data[0];
+}
+
+/**
+ * back()
+ *
+ * @return a reference to the last element of the vector
+ * @exception out_of_range if there are no elements in the vector
+ */
+template<class T>
+T& Vector<T>::back()
+{
+    if(size == 0)
+        throw std::out_of_range("Vector<T>::back() - vector is empty");
+    return data[size - 1];
+}
+
+/**
+ * get(int index)
+ *
+ * @param index : the index of an element within the vector
+ * @return a copy of the element at the index
+ * @exception out_of_range if the index is not within [0, size)
+ */
+template<class T>
+T Vector<T>::get(int index) const
+{
+    if(index < 0 || index >= size)
+        throw std::out_of_range("Vector<T>::get() - index is out of range");
+    return data[index];
+}
+
+/**
+ * operator[] (int index)
+ *
+ * Unlike get(index), the index is not checked, and a REFERENCE is returned
+ * so data can be manipulated within the vector.
+ *
+ * @param index : the index of an element within [0, size)
+ * @return a reference to the element at the index
+ */
+template<class T>
+T& Vector<T>::operator[](int index)
+{
+    return data[index];
+}
+
+/**
+ * operator[] (int index) const
+ *
+ * @param index : the index of an element within [0, size)
+ * @return a const reference to the element at the index
+ */
+template<class T>
+const T& Vector<T>::operator[](int index) const
+{
+    return data[index];
+}
+
+/**
+ * find(const T& value)
+ *
+ * @param value : the element to search for within the vector
+ * @return the index of the first element equal to value, -1 if not found
+ */
+template<class T>
+int Vector<T>::find(const T& value) const
+{
+    for(int i{}; i < size; i++)
+    {
+        if(value == data[i])
+            return i;
+    }
+    return -1;
+}
+
+
+//Modifier functions
+
+/**
+ * pushBack(const T& value)
+ *
+ * Adds a copy of the element to the end of the vector, doubling the size
+ * of the array if it is full.
+ *
+ * @param value : the element to add to the vector
+ */
+template<class T>
+void Vector<T>::pushBack(const T& value)
+{
+    if(size == capacity)
+    {
+        //copy first, in case value is an element of this vector
+        T temp{value};
+        reallocate((capacity == 0) ? 16 : capacity * 2);
+        data[size++] = std::move(temp);
+    }
+    else
+        data[size++] = value;
+}
+
+/**
+ * pushBack(T&& value)
+ *
+ * Moves the element to the end of the vector, doubling the size of the
+ * array if it is full.
+ *
+ * @param value : the element to move into the vector
+ */
+template<class T>
+void Vector<T>::pushBack(T&& value)
+{
+    if(size == capacity)
+    {
+        T temp{std::move(value)};
+        reallocate((capacity == 0) ? 16 : capacity * 2);
+        data[size++] = std::move(temp);
+    }
+    else
+        data[size++] = std::move(value);
+}
+
+/**
+ * uniquePushBack(const T& value)
+ *
+ * Adds the element to the end of the vector, only if it is not already
+ * within the vector.
+ *
+ * @param value : the element to add to the vector
+ * @return the index of the element within the vector
+ */
+template<class T>
+int Vector<T>::uniquePushBack(const T& value)
+{
+    int index = find(value);
+    if(index != -1)
+        return index;
+
+    pushBack(value);
+    return size - 1;
+}
+
+/**
+ * popBack()
+ *
+ * @return the last element of the vector, which is removed
+ * @exception out_of_range if there are no elements in the vector
+ */
+template<class T>
+T Vector<T>::popBack()
+{
+    if(size == 0)
+        throw std::out_of_range("Vector<T>::popBack() - vector is empty");
+
+    size--;
+    T value{std::move(data[size])};
+    data[size] = T();
+    return value;
+}
+
+/**
+ * resize(int size, const T& val)
+ *
+ * Removes elements from the end of the vector until it is the given size,
+ * or adds copies of val to the end until it is the given size.
+ *
+ * @param size : the new size of the vector
+ * @param val : the element added if the vector is smaller than the size
+ * @exception out_of_range if the given size is < 0
+ */
+template<class T>
+void Vector<T>::resize(int size, const T& val)
+{
+    if(size < 0)
+        throw std::out_of_range("resize(): negative index is not allowed");
+
+    reserve(size);
+    while(this->size > size)
+        popBack();
+    while(this->size < size)
+        data[this->size++] = val;
+}
+
+/**
+ * clear()
+ *
+ * Removes every element from the vector. The array is kept, so the vector
+ * can be refilled without being reallocated.
+ */
+template<class T>
+void Vector<T>::clear()
+{
+    while(size != 0)
+        data[--size] = T();
+}
+
+
+//Iterators
+
+/**
+ * begin()
+ * @return a pointer to the first element of the vector
+ */
+template<class T>
+T* Vector<T>::begin()
+{
+    return data;
+}
+
+/**
+ * end()
+ * @return a pointer one past the last element of the vector
+ */
+template<class T>
+T* Vector<T>::end()
+{
+    return data + size;
+}
+
+/**
+ * begin() const
+ * @return a const pointer to the first element of the vector
+ */
+template<class T>
+const T* Vector<T>::begin() const
+{
+    return data;
+}
+
+/**
+ * end() const
+ * @return a const pointer one past the last element of the vector
+ */
+template<class T>
+const T* Vector<T>::end() const
+{
+    return data + size;
+}
+
+/**
+ * operator<<(std::ostream& o, const Vector& vec)
+ *
+ * Returns an ostream& reference containing output for the Vector, in the
+ * same format as the LinkedList.
+ *
+ * Example output:
+ *
+ * [1, 2, 3, 4, 5]
+ *
+ * @param o : the ostream reference to return, containing output for the
+ *            vector
+ * @param vec : a constant reference to a Vector that will be outputted
+ *              using the ostream& o
+ * @return an ostream& o that can be used to output the contents of the vector
+ */
+template<class S>
+std::ostream& operator<<(std::ostream& o, const Vector<S>& vec)
+{
+    o << "[";
+    for(int i{}; i < vec.size; i++)
+    {
+        if(i > 0)
+            o << ", ";
+        o << vec.data[i];
+    }
+    o << "]";
+    return o;
+}
+
+#endif
@@ -0,0 +1,71 @@
+#include "visitedset.h"
+
+/**
+ * Constructor with int
+ * @param size - the number of indices that can be visited
+ */
+VisitedSet::VisitedSet(int size) : size{size}, stamps{new unsigned int[size]},
+    epoch{0}
+{
+    for(int i{}; i < size; i++)
+        stamps[i] = 0;
+}
+
+/**
+ * Destructor
+ */
+VisitedSet::~VisitedSet()
+{
+    delete[] stamps;
+}
+
+/**
+ * newEpoch()
+ *
+ * Epoch 0 is never given out, since it is the stamp of unvisited indices.
+ * When the counter wraps around, every stamp is cleared so old epochs
+ * cannot be mistaken for new ones.
+ *
+ * @return an epoch in which no index has been visited
+ */
+unsigned int VisitedSet::newEpoch()
+{
+    epoch++;
+    if(epoch == 0)
+    {
+        for(int i{}; i < size; i++)
+            stamps[i] = 0;
+        epoch = 1;
+    }
+    return epoch;
+}
+
+/**
+ * visit(index, epoch)
+ * @param index - the index to mark
+ * @param epoch - the epoch to mark the index as visited within
+ */
+void VisitedSet::visit(int index, unsigned int epoch)
+{
+    stamps[index] = epoch;
+}
+
+/**
+ * unvisit(index)
+ * @param index - the index to unmark, so it is not visited in any epoch
+ */
+void VisitedSet::unvisit(int index)
+{
+    stamps[index] = 0;
+}
+
+/**
+ * isVisited(index, epoch)
+ * @param index - the index to check
+ * @param epoch - the epoch to check
+ * @return true if the index was last visited within the epoch
+ */
+bool VisitedSet::isVisited(int index, unsigned int epoch) const
+{
+    return stamps[index] == epoch;
+}
@@ -0,0 +1,48 @@
+#ifndef VISITEDSET_H
+#define VISITEDSET_H
+
+/**
+ * The VisitedSet class marks which flights (or cities) a search has visited,
+ * keeping the marks outside of the flight schedule so the schedule can be
+ * shared between searches without being copied.
+ *
+ * Rather than a flag, each index holds the epoch it was last visited in. A
+ * search asks for a new epoch instead of clearing the array, so starting a
+ * search takes constant time, and searches only touch the indices they
+ * visit. The array is only cleared when the epoch counter wraps around.
+ *
+ * This class will be used in the Sprint4: Flight Planner project
+ * in SMU CSE 2341.
+ *
+ * @author Oisin Coveney
+ * @date October 17, 2026
+ */
+class VisitedSet
+{
+    private:
+        int size;
+        unsigned int* stamps;       //epoch each index was last visited in
+        unsigned int epoch;         //last epoch given out
+
+    public:
+
+        //Constructors and destructor
+        VisitedSet(int size);
+        VisitedSet(const VisitedSet& other) = delete;
+        VisitedSet& operator=(const VisitedSet& other) = delete;
+        ~VisitedSet();
+
+        //Returns an epoch that no index has been visited in yet
+        unsigned int newEpoch();
+
+        //Marks the index as visited within the epoch
+        void visit(int index, unsigned int epoch);
+
+        //Removes the mark of the index
+        void unvisit(int index);
+
+        //Returns true if the index was visited within the epoch
+        bool isVisited(int index, unsigned int epoch) const;
+};
+
+#endif // VISITEDSET_H